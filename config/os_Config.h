@@ -0,0 +1,158 @@
+/*
+ * os_Config.h
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+#ifndef _OS_CONFIG_H_
+#define _OS_CONFIG_H_
+
+/**
+ * @defgroup os_config Kernel configuration
+ * @brief Build-time configuration of the kernel and its modules. The Makefile
+ * adds the folder of this file to the include path, so another configuration
+ * is selected with "make OS_CONFIG_DIR=<folder>" and any value can also be
+ * overridden with -D. A disabled feature compiles to nothing. The values are
+ * validated in os_Core.h.
+ * @{
+ */
+
+/* macros --------------------------------------------------------------------*/
+
+/* Kernel features, 1 to enable and 0 to disable */
+#ifndef OS_USE_SEMAPHORES
+#define OS_USE_SEMAPHORES		1	/**< Binary semaphores */
+#endif
+
+#ifndef OS_USE_QUEUES
+#define OS_USE_QUEUES			1	/**< Queues */
+#endif
+
+#ifndef OS_USE_PRIORITY_QUEUES
+#define OS_USE_PRIORITY_QUEUES	1	/**< Priority queues */
+#endif
+
+#ifndef OS_USE_QUEUE_SETS
+#define OS_USE_QUEUE_SETS		1	/**< Queue sets, needs semaphores and queues */
+#endif
+
+#ifndef OS_USE_TASK_CONTROL
+#define OS_USE_TASK_CONTROL		1	/**< Tasks deletion, suspension and resumption */
+#endif
+
+#ifndef OS_USE_IRQS
+#define OS_USE_IRQS				1	/**< IRQ handlers installed at run time, the vector table entries of the kernel */
+#endif
+
+#ifndef OS_USE_IRQ_RATE_LIMIT
+#define OS_USE_IRQ_RATE_LIMIT	1	/**< IRQ rate limiting, needs the IRQ handlers */
+#endif
+
+#ifndef OS_FPU_TRAP
+#define OS_FPU_TRAP				0	/**< FPU disabled while an integer task runs, so it faults on a floating point instruction. The ISRs must not use the FPU */
+#endif
+
+#ifndef OBJECT_STATS
+#define OBJECT_STATS			0	/**< Per-object statistics and registry */
+#endif
+
+#ifndef OS_USE_POSTMORTEM
+#define OS_USE_POSTMORTEM		1	/**< Post-mortem snapshot in no-init RAM */
+#endif
+
+/* Modules, 1 to enable and 0 to disable */
+#ifndef OS_USE_ACTIVE
+#define OS_USE_ACTIVE			1	/**< Active objects (os_Active) */
+#endif
+
+#ifndef OS_USE_COROUTINES
+#define OS_USE_COROUTINES		1	/**< Stackless coroutines (os_Coroutine) */
+#endif
+
+#ifndef OS_USE_CYCLIC
+#define OS_USE_CYCLIC			1	/**< Cyclic executive (os_Cyclic) */
+#endif
+
+#ifndef OS_USE_DMA
+#define OS_USE_DMA				1	/**< DMA channels (os_Dma) */
+#endif
+
+#ifndef OS_USE_ACQUIRE
+#define OS_USE_ACQUIRE			1	/**< Multi-buffer DMA acquisition (os_Acquire) */
+#endif
+
+#ifndef OS_USE_UART
+#define OS_USE_UART				1	/**< UART driver (os_Uart) */
+#endif
+
+#ifndef OS_USE_LOG
+#define OS_USE_LOG				1	/**< Binary logging (os_Log) */
+#endif
+
+#ifndef OS_USE_IPC
+#define OS_USE_IPC				1	/**< Inter-core calls (os_Ipc) */
+#endif
+
+#ifndef OS_USE_PROBES
+#define OS_USE_PROBES			1	/**< Latency probes (os_Probe) */
+#endif
+
+#ifndef OS_USE_SEQLOCKS
+#define OS_USE_SEQLOCKS			1	/**< Sequence locks (os_SeqLock) */
+#endif
+
+#ifndef OS_USE_STREAMS
+#define OS_USE_STREAMS			1	/**< Byte streams (os_Stream) */
+#endif
+
+#ifndef OS_USE_WORK_QUEUES
+#define OS_USE_WORK_QUEUES		1	/**< Work queues (os_Work) */
+#endif
+
+/* Sizes */
+#ifndef SYSTICK_TIME
+#define SYSTICK_TIME			1000	/**< SysTick period in us */
+#endif
+
+#ifndef TIME_SLICE_TICKS
+#define TIME_SLICE_TICKS		10		/**< Default time slice in ticks, 0 for cooperative mode */
+#endif
+
+#ifndef TASKS_MAX
+#define TASKS_MAX				64		/**< Max number of tasks */
+#endif
+
+#ifndef PRIORITY_LEVELS
+#define PRIORITY_LEVELS			8		/**< Number of priorities, higher value is higher priority */
+#endif
+
+#ifndef STACK_SIZE_BYTES
+#define STACK_SIZE_BYTES		512		/**< Stack size of each task in bytes */
+#endif
+
+#ifndef QUEUE_SIZE_BYTES
+#define QUEUE_SIZE_BYTES		64		/**< Queue size in bytes */
+#endif
+
+#ifndef QUEUE_SET_SIZE
+#define QUEUE_SET_SIZE			8		/**< Max number of members in a queue set */
+#endif
+
+#ifndef QUEUE_PRIORITIES
+#define QUEUE_PRIORITIES		8		/**< Message priorities of a priority queue, higher value is higher priority */
+#endif
+
+#ifndef POSTMORTEM_SWITCHES
+#define POSTMORTEM_SWITCHES		16		/**< Context switches kept in the post-mortem snapshot, power of 2 */
+#endif
+
+#ifndef IRQ_COALESCE_MAX
+#define IRQ_COALESCE_MAX		4		/**< Max number of IRQs with rate limiting */
+#endif
+
+/** @} doxygen end group definition */
+
+/* end of file ---------------------------------------------------------------*/
+
+#endif /* #ifndef _OS_CONFIG_H_ */
@@ -0,0 +1,354 @@
+/*
+ * os.hpp
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+#ifndef _OS_HPP_
+#define _OS_HPP_
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+#include <new>
+
+#include "os_Core.h"
+
+/**
+ * @defgroup os_cpp C++ layer
+ * @brief Header only C++17 templates over the C API. The storage is sized at
+ * compile time, the elements are copied by type, not by memcpy with a
+ * runtime size, and the capacities are checked by the compiler.
+ * @{
+ */
+
+namespace os {
+
+/* typedef -------------------------------------------------------------------*/
+
+/**
+ * @brief RAII guard of the kernel critical section.
+ */
+class Critical {
+public:
+	Critical() { os_EnterCritical(); }
+	~Critical() { os_ExitCritical(); }
+
+	Critical(const Critical &) = delete;
+	Critical & operator=(const Critical &) = delete;
+};
+
+#if OS_USE_SEMAPHORES
+/**
+ * @brief Typed FIFO queue with N elements of type T. The elements are stored
+ * in the object and copied by assignment, a binary semaphore is given while
+ * the queue has elements and the receiver waits on it. Same semantics as the
+ * C queue: the send never blocks and fails when the queue is full, the
+ * receive blocks up to a timeout. Only one task can wait on it at a time.
+ */
+template <typename T, size_t N>
+class Queue {
+	static_assert(N > 0, "Queue capacity must be greater than zero");
+	static_assert(N <= UINT16_MAX, "Queue capacity too big");
+	static_assert(std::is_trivially_copyable<T>::value, "Queue elements must be trivially copyable");
+
+public:
+	Queue() : head(0), tail(0), count(0) { Semaphore_Init(&notEmpty); }
+
+	Queue(const Queue &) = delete;
+	Queue & operator=(const Queue &) = delete;
+
+	/**
+	 * @brief Send/write an element into the queue. Callable from ISRs.
+	 * @param item
+	 * @return - true: successful
+	 * 		   - false: fail, the queue is full
+	 */
+	bool send(const T & item) {
+		Critical lock;
+
+		if(count == N) {
+			return false;
+		}
+
+		data[tail] = item;
+		tail = next(tail);
+		count++;
+		signal();
+
+		return true;
+	}
+
+	/**
+	 * @brief Send/write up to count elements with one wakeup. Callable from
+	 * 		  ISRs.
+	 * @param items
+	 * @param count
+	 * @return number of elements sent, less than count if the queue filled
+	 */
+	size_t send(const T * items, size_t count) {
+		size_t sent = 0;
+
+		Critical lock;
+
+		while(sent < count && this->count < N) {
+			data[tail] = items[sent++];
+			tail = next(tail);
+			this->count++;
+		}
+
+		signal();
+
+		return sent;
+	}
+
+	/**
+	 * @brief Receive/read an element from the queue.
+	 * @param item
+	 * @param ticks 0 to return right away if the queue is empty
+	 * @return - true: successful
+	 * 		   - false: fail, no data received before the timeout
+	 */
+	bool receive(T & item, uint32_t ticks = MAX_TIME_DELAY) {
+		uint32_t start = 0;
+
+		os_GetTickCounter(&start);
+
+		for(;;) {
+			{
+				Critical lock;
+
+				if(count > 0) {
+					item = data[head];
+					head = next(head);
+					count--;
+					signal();
+
+					return true;
+				}
+			}
+
+			if(wait(start, ticks) == false) {
+				return false;
+			}
+		}
+	}
+
+	/**
+	 * @brief Receive/read up to count elements, waiting until at least min
+	 * 		  are received.
+	 * @param items
+	 * @param count
+	 * @param min
+	 * @param ticks 0 to return right away with the elements available
+	 * @return number of elements received, less than min on timeout
+	 */
+	size_t receive(T * items, size_t count, size_t min, uint32_t ticks = MAX_TIME_DELAY) {
+		size_t received = 0;
+		uint32_t start = 0;
+
+		os_GetTickCounter(&start);
+
+		for(;;) {
+			{
+				Critical lock;
+
+				while(received < count && this->count > 0) {
+					items[received++] = data[head];
+					head = next(head);
+					this->count--;
+				}
+
+				signal();
+			}
+
+			if(received >= min || received == count || wait(start, ticks) == false) {
+				return received;
+			}
+		}
+	}
+
+	/**
+	 * @brief Semaphore given while the queue has elements, e.g. to add the
+	 * 		  queue to a set with QueueSet_AddSemaphore(). Once selected, the
+	 * 		  queue is read with receive(), not with Semaphore_Take().
+	 */
+	Semaphore_t * handle() { return &notEmpty; }
+
+	size_t size() const { return count; }
+	static constexpr size_t capacity() { return N; }
+
+private:
+	static constexpr uint16_t next(uint16_t i) { return (i + 1 == N) ? 0 : i + 1; }
+
+	/* Called in the critical section that changes count, so the semaphore
+	 * is given exactly while there are elements */
+	void signal() {
+		if(count == 0) {
+			if(notEmpty.isGiven == true) {
+				Semaphore_TryTake(&notEmpty);
+			}
+		}
+		else if(notEmpty.isGiven == false) {
+			Semaphore_Give(&notEmpty);
+		}
+	}
+
+	/* The semaphore can be given for elements already read by another
+	 * task, so the queue is checked again with the time left */
+	bool wait(uint32_t start, uint32_t ticks) {
+		uint32_t now = 0;
+		uint32_t left = ticks;
+
+		if(ticks != MAX_TIME_DELAY) {
+			os_GetTickCounter(&now);
+
+			if(TICKS_DIFF(now, start) >= ticks) {
+				return false;
+			}
+
+			left = ticks - TICKS_DIFF(now, start);
+		}
+
+		return Semaphore_TakeTimeout(&notEmpty, left) == OS_OK;
+	}
+
+	T data[N];
+	volatile uint16_t head;
+	volatile uint16_t tail;
+	volatile uint16_t count;
+	Semaphore_t notEmpty;
+};
+#endif
+
+/**
+ * @brief Task with a stack of StackBytes bytes in the object itself. The
+ * object must outlive the task, so it is usually a global. Fpu declares a
+ * task that uses floating point, the others are integer only.
+ */
+template <size_t StackBytes, bool Fpu = false>
+class Task {
+	static_assert(StackBytes % 8 == 0, "Task stack size must be a multiple of 8 bytes");
+	static_assert(StackBytes / sizeof(uint32_t) >= (Fpu ? FPU_TASK_STACK_MIN : TASK_STACK_MIN),
+			"Task stack too small for the context");
+
+public:
+	Task() = default;
+
+	Task(const Task &) = delete;
+	Task & operator=(const Task &) = delete;
+
+	/**
+	 * @brief Create the task.
+	 * @param entry
+	 * @param name
+	 * @param priority lower than PRIORITY_LEVELS, not PRIORITY_RESERVED
+	 * @param arg
+	 * @return - OS_OK: successful
+	 * 		   - OS_FAIL: fail
+	 */
+	os_Error_t create(void (*entry)(void *), const char * name, uint32_t priority, void * arg = nullptr) {
+		if constexpr (Fpu) {
+			return os_CreateTaskFpu(reinterpret_cast<void *>(entry), name, priority, arg,
+					stack, StackBytes / sizeof(uint32_t));
+		}
+		else {
+			return os_CreateTaskStatic(reinterpret_cast<void *>(entry), name, priority, arg,
+					stack, StackBytes / sizeof(uint32_t));
+		}
+	}
+
+	static constexpr size_t stackSize() { return StackBytes; }
+
+private:
+	alignas(8) uint32_t stack[StackBytes / sizeof(uint32_t)];
+};
+
+/**
+ * @brief Fixed block pool of N objects of type T. Allocation and release are
+ * O(1) and callable from ISRs.
+ */
+template <typename T, size_t N>
+class Pool {
+	static_assert(N > 0, "Pool capacity must be greater than zero");
+
+public:
+	Pool() : freeList(nullptr), used(0) {
+		for(size_t i = 0; i < N; i++) {
+			blocks[i].next = freeList;
+			freeList = &blocks[i];
+		}
+	}
+
+	Pool(const Pool &) = delete;
+	Pool & operator=(const Pool &) = delete;
+
+	/**
+	 * @brief Take a block and construct the object in it.
+	 * @param args constructor arguments
+	 * @return pointer to the object or nullptr if the pool is empty
+	 */
+	template <typename... Args>
+	T * allocate(Args &&... args) {
+		Block * block;
+
+		{
+			Critical lock;
+
+			block = freeList;
+
+			if(block == nullptr) {
+				return nullptr;
+			}
+
+			freeList = block->next;
+			used++;
+		}
+
+		return new (block->storage) T(static_cast<Args &&>(args)...);
+	}
+
+	/**
+	 * @brief Destroy the object and give its block back to the pool.
+	 * @param object
+	 */
+	void free(T * object) {
+		if(object == nullptr) {
+			return;
+		}
+
+		object->~T();
+
+		Block * block = reinterpret_cast<Block *>(object);
+
+		Critical lock;
+
+		block->next = freeList;
+		freeList = block;
+		used--;
+	}
+
+	size_t size() const { return used; }
+	static constexpr size_t capacity() { return N; }
+
+private:
+	union Block {
+		Block * next;
+		alignas(T) unsigned char storage[sizeof(T)];
+	};
+
+	Block blocks[N];
+	Block * freeList;
+	volatile size_t used;
+};
+
+} /* namespace os */
+
+/** @} doxygen end group definition */
+
+/* end of file ---------------------------------------------------------------*/
+
+#endif /* #ifndef _OS_HPP_ */
@@ -0,0 +1,132 @@
+/*
+ * os_Acquire.h
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+#ifndef _OS_ACQUIRE_H_
+#define _OS_ACQUIRE_H_
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Core.h"
+#include "os_Dma.h"
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* macros --------------------------------------------------------------------*/
+
+/*
+ * Acquisition with several buffers: the DMA fills one buffer while the task
+ * processes the previous ones in place. A buffer is owned by the DMA, ready
+ * (filled, waiting for the task) or held by the task, and it changes owner
+ * without any copy.
+ *
+ * The buffers are chained with linked list items (one descriptor per
+ * buffer), so the DMA goes on with the next buffer by itself at the end of
+ * each one, without a gap between the samples. The DMA loads the link of a
+ * buffer when it starts filling it, so the interrupt of a buffer decides
+ * the link of the buffer after the next one. If there is no free buffer
+ * then, the buffer is linked to itself: its data is overwritten by the next
+ * transfer and counted as an overrun, so the DMA never stops. The interrupt
+ * must be served within the time of one buffer. The descriptors are part of
+ * Acquire_t, so it must be in memory the DMA can read.
+ */
+
+#define ACQUIRE_BUFFERS_MIN	3		/**< Min number of buffers */
+#define ACQUIRE_BUFFERS_MAX	8		/**< Max number of buffers */
+#define ACQUIRE_SAMPLES_MAX	0xFFF	/**< Max samples per buffer, transfer size field of the GPDMA */
+
+/* typedef -------------------------------------------------------------------*/
+
+/**
+ * @brief Acquisition control structure.
+ */
+typedef struct {
+	uint32_t peripheral;	/**< GPDMA peripheral connection of the source */
+	uint8_t channel;		/**< GPDMA channel */
+	uint32_t * storage;		/**< Buffers storage, provided by the user */
+	size_t samples;			/**< Samples (words) per buffer */
+	uint8_t count;			/**< Number of buffers */
+	uint8_t fill;			/**< Buffer being filled by the DMA */
+	uint8_t queued;			/**< Buffer the DMA fills next, already loaded */
+	uint8_t head;			/**< Oldest buffer ready or held by the task */
+	uint8_t ready;			/**< Buffers filled and not taken by the task */
+	uint8_t held;			/**< Buffers taken by the task and not released */
+	bool running;			/**< Acquisition started */
+	uint32_t overruns;		/**< Transfers lost because there was no free buffer */
+	uint32_t errors;		/**< Transfers with error */
+	Semaphore_t full;		/**< Given each time a buffer is ready */
+	DMA_TransferDescriptor_t descriptors[ACQUIRE_BUFFERS_MAX];	/**< Descriptor of each buffer, read by the DMA */
+} Acquire_t;
+
+/* external data declaration -------------------------------------------------*/
+
+/* external functions declaration --------------------------------------------*/
+
+/**
+ * @brief Acquisition initialization, gets a GPDMA channel for the source.
+ * @param me
+ * @param peripheral GPDMA source connection, e.g. GPDMA_CONN_ADC_0
+ * @param storage count * samples words
+ * @param count number of buffers, ACQUIRE_BUFFERS_MIN to ACQUIRE_BUFFERS_MAX.
+ * 		  The links are decided one buffer ahead, so it takes one buffer
+ * 		  more than a double buffer
+ * @param samples samples (words) per buffer, up to ACQUIRE_SAMPLES_MAX
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t Acquire_Init(Acquire_t * const me, uint32_t peripheral, uint32_t * storage, size_t count, size_t samples);
+
+/**
+ * @brief Acquisition API to start the transfers.
+ * @param me
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t Acquire_Start(Acquire_t * const me);
+
+/**
+ * @brief Acquisition API to stop the transfers.
+ * @param me
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t Acquire_Stop(Acquire_t * const me);
+
+/**
+ * @brief Acquisition API to take the oldest buffer ready. The task owns it
+ * 		  until it is released.
+ * @param me
+ * @param buffer
+ * @param ticks 0 to return right away if no buffer is ready
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, no buffer ready before the timeout
+ */
+os_Error_t Acquire_Get(Acquire_t * const me, uint32_t ** buffer, uint32_t ticks);
+
+/**
+ * @brief Acquisition API to give the oldest buffer taken back to the DMA.
+ * 		  The buffers are released in the same order they were taken.
+ * @param me
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, no buffer held
+ */
+os_Error_t Acquire_Release(Acquire_t * const me);
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} doxygen end group definition */
+
+/* end of file ---------------------------------------------------------------*/
+
+#endif /* #ifndef _OS_ACQUIRE_H_ */
@@ -0,0 +1,104 @@
+/*
+ * os_Active.h
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+#ifndef _OS_ACTIVE_H_
+#define _OS_ACTIVE_H_
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Core.h"
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* macros --------------------------------------------------------------------*/
+
+/*
+ * Active objects run to completion: each event is handled by a call to the
+ * handler that must return without blocking. Every priority level is
+ * dispatched from an IRQ that is not used by the application and is pended
+ * by software, so a higher level preempts a lower one through the NVIC and
+ * all of them run on the shared exception stack (MSP), above every task.
+ */
+
+#define ACTIVE_LEVELS			4	/**< Number of active object priorities */
+#define ACTIVE_NVIC_PRIORITY	6	/**< NVIC priority of the lowest level, the level n uses ACTIVE_NVIC_PRIORITY - n */
+
+/* IRQs used to dispatch each level, the first one is the lowest priority */
+#define ACTIVE_IRQS			{C_CAN0_IRQn, C_CAN1_IRQn, QEI_IRQn, MCPWM_IRQn}
+
+/* typedef -------------------------------------------------------------------*/
+
+/**
+ * @brief Active object event.
+ */
+typedef struct {
+	uint32_t signal;	/**< Event signal */
+	uint32_t param;		/**< Event parameter */
+} Active_Event_t;
+
+/**
+ * @brief Active object control structure.
+ */
+typedef struct Active_s {
+	void (* handler)(struct Active_s * const, const Active_Event_t *);	/**< Run-to-completion handler */
+	Active_Event_t * queue;				/**< Events queue storage, provided by the user */
+	uint8_t len;						/**< Events queue length */
+	uint8_t head;						/**< Next event to dispatch */
+	uint8_t count;						/**< Events in the queue */
+	uint8_t priority;					/**< Level, 0 is the lowest */
+	uint32_t dropped;					/**< Events lost because the queue was full */
+	struct Active_s * next;				/**< Next active object of the same level */
+} Active_t;
+
+/**
+ * @brief Active object handler type.
+ */
+typedef void (* Active_Handler_t)(Active_t * const me, const Active_Event_t * event);
+
+/* external data declaration -------------------------------------------------*/
+
+/* external functions declaration --------------------------------------------*/
+
+/**
+ * @brief Active object start. Registers the active object in its level and
+ * 		  installs the level dispatcher the first time.
+ * @param me
+ * @param handler
+ * @param priority lower than ACTIVE_LEVELS
+ * @param queue events storage
+ * @param len number of events of the storage
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t Active_Start(Active_t * const me, Active_Handler_t handler, uint32_t priority, Active_Event_t * queue, size_t len);
+
+/**
+ * @brief Active object API to post an event. The event is copied, can be
+ * 		  called from tasks, ISRs and other active objects.
+ * @param me
+ * @param signal
+ * @param param
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, the events queue is full
+ */
+os_Error_t Active_Post(Active_t * const me, uint32_t signal, uint32_t param);
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} doxygen end group definition */
+
+/* end of file ---------------------------------------------------------------*/
+
+#endif /* #ifndef _OS_ACTIVE_H_ */
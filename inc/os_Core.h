@@ -13,6 +13,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "board.h"
+#include "os_Config.h"
 
 /* cplusplus -----------------------------------------------------------------*/
 
@@ -24,13 +25,16 @@ extern "C" {
 
 /* Idle task*/
 #define IDLE_TASK_PRIORITY	0UL			/**< Idle task default priority */
-#define IDLE_TASK_ID		0xFFFFFFFF	/**< Idle task default ID */
+#define IDLE_TASK_ID		TASKS_MAX	/**< Idle task default ID, last entry of the tasks tables */
 
-/* SysTick */
-#define SYSTICK_TIME		1000	/**< SysTick time in us */
+/* Highest priority, only given to the cyclic executive when it is used */
+#define PRIORITY_RESERVED	(OS_USE_CYCLIC ? PRIORITY_LEVELS - 1 : PRIORITY_LEVELS)
+
+/* Wrap-safe tick comparisons */
+#define TICKS_DIFF(a, b)	((uint32_t)((a) - (b)))			/**< Ticks elapsed from b to a */
+#define TICKS_AFTER(a, b)	((int32_t)((b) - (a)) < 0)		/**< True if tick a is after tick b */
 
 /**/
-#define STACK_SIZE_BYTES	512					/**< Stack frame size in bytes */
 #define STACK_SIZE_WORDS	(STACK_SIZE_BYTES \
 							/ sizeof(uint32_t))	/**< Stack frame size in words */
 
@@ -55,22 +59,113 @@ extern "C" {
 
 /**/
 #define INIT_XPSR 			1 << 24		/**< Set xPSR Thumb bit */
-#define EXC_RETURN			0xFFFFFFF9	/**< EXC_RETURN value to return to thread mode, no FPU */
+#define EXC_RETURN			0xFFFFFFFD	/**< EXC_RETURN value to return to thread mode with PSP, no FPU */
 
 /**/
 #define STACK_FRAME_SIZE	8	/**< Stack frame size */
 #define FULL_STACKING_SIZE	17	/**< Full stack frame size */
-#define TASKS_MAX			8	/**< Max number of tasks */
+#define FPU_STACKING_SIZE	16	/**< Words of the FPU registers saved by PendSV (s16-s31) */
+#define FPU_FRAME_SIZE		18	/**< Words added by the hardware to the stack frame of a context using the FPU (s0-s15, FPSCR, reserved) */
+#define TASK_STACK_MIN		FULL_STACKING_SIZE	/**< Min stack of an integer task in words, the context saved by a switch */
+#define FPU_TASK_STACK_MIN	(FULL_STACKING_SIZE + FPU_FRAME_SIZE \
+							+ FPU_STACKING_SIZE)	/**< Min stack of a FPU task in words, the context saved by a switch */
 #define TASK_NAME_LEN		16	/**< Length of tasks names*/
+#define TASK_NONE			0xFF	/**< Invalid task ID, end of the tasks lists */
+#define READY_WORDS			((TASKS_MAX + 31) / 32)	/**< Words of the ready bitmap of a priority */
+
+/* Stacks of the tasks. With many tasks they do not fit in the default RAM
+ * bank next to the rest of .bss, so they are placed in their own section */
+#define STACKS_SECTION		".bss.$RamLoc40"	/**< Linker section for the tasks stacks */
+
+/* Post-mortem snapshot. Its section is NOLOAD and not zeroed by the startup
+ * code, so it survives a watchdog or software reset. ld/os_noinit.ld adds it
+ * to a linker script that does not have it */
+#define POSTMORTEM_SECTION	".noinit"		/**< Linker section for the post-mortem snapshots */
+#define POSTMORTEM_MAGIC	0x504D4F53		/**< Valid snapshot mark */
+#define STACK_PAINT			0xA5A5A5A5		/**< Value of the stack words never used */
 
 /**/
 #define MAX_TIME_DELAY		0xFFFFFFFF	/**< Max delay time */
 
 /**/
-#define QUEUE_SIZE_BYTES	64			/**< Queue size in bytes */
+#define QUEUE_SLOT_NONE		0xFF		/**< Invalid slot, end of the priority queue lists */
 
 /**/
 #define IRQ_NUM				53			/**< IRQ available number */
+#define IRQ_COALESCE_NONE	0xFF		/**< IRQ without rate limiting */
+
+/* Configuration checks */
+#if TASKS_MAX < 1 || TASKS_MAX >= TASK_NONE
+#error "TASKS_MAX must be between 1 and TASK_NONE - 1"
+#endif
+
+#if PRIORITY_LEVELS < 1 || PRIORITY_LEVELS > 32
+#error "PRIORITY_LEVELS must be between 1 and 32"
+#endif
+
+#if OS_USE_CYCLIC && PRIORITY_LEVELS < 3
+#error "OS_USE_CYCLIC needs PRIORITY_LEVELS 3 or higher"
+#endif
+
+#if STACK_SIZE_BYTES % 8 != 0
+#error "STACK_SIZE_BYTES must be a multiple of 8"
+#endif
+
+#if STACK_SIZE_BYTES < TASK_STACK_MIN * 4
+#error "STACK_SIZE_BYTES too small for the context of a task"
+#endif
+
+#if SYSTICK_TIME < 1 || 1000000 % SYSTICK_TIME != 0
+#error "SYSTICK_TIME must be a divisor of 1000000 us"
+#endif
+
+#if TIME_SLICE_TICKS < 0 || TIME_SLICE_TICKS > 255
+#error "TIME_SLICE_TICKS must be between 0 and 255"
+#endif
+
+#if QUEUE_SIZE_BYTES < 1 || (OS_USE_PRIORITY_QUEUES && QUEUE_SIZE_BYTES >= QUEUE_SLOT_NONE)
+#error "QUEUE_SIZE_BYTES must be between 1 and QUEUE_SLOT_NONE - 1"
+#endif
+
+#if QUEUE_PRIORITIES < 1 || QUEUE_PRIORITIES > 32
+#error "QUEUE_PRIORITIES must be between 1 and 32"
+#endif
+
+#if QUEUE_SET_SIZE < 1
+#error "QUEUE_SET_SIZE must be 1 or higher"
+#endif
+
+#if IRQ_COALESCE_MAX < 1 || IRQ_COALESCE_MAX >= IRQ_COALESCE_NONE
+#error "IRQ_COALESCE_MAX must be between 1 and IRQ_COALESCE_NONE - 1"
+#endif
+
+#if OS_USE_QUEUE_SETS && !(OS_USE_SEMAPHORES && OS_USE_QUEUES)
+#error "OS_USE_QUEUE_SETS needs OS_USE_SEMAPHORES and OS_USE_QUEUES"
+#endif
+
+#if OS_USE_IRQ_RATE_LIMIT && !OS_USE_IRQS
+#error "OS_USE_IRQ_RATE_LIMIT needs OS_USE_IRQS"
+#endif
+
+#if (OS_USE_ACTIVE || OS_USE_DMA || OS_USE_IPC) && !OS_USE_IRQS
+#error "OS_USE_ACTIVE, OS_USE_DMA and OS_USE_IPC need OS_USE_IRQS"
+#endif
+
+#if (OS_USE_ACQUIRE || OS_USE_UART) && !(OS_USE_DMA && OS_USE_SEMAPHORES)
+#error "OS_USE_ACQUIRE and OS_USE_UART need OS_USE_DMA and OS_USE_SEMAPHORES"
+#endif
+
+#if (OS_USE_IPC || OS_USE_STREAMS || OS_USE_WORK_QUEUES) && !OS_USE_SEMAPHORES
+#error "OS_USE_IPC, OS_USE_STREAMS and OS_USE_WORK_QUEUES need OS_USE_SEMAPHORES"
+#endif
+
+#if OS_USE_LOG && !OS_USE_UART
+#error "OS_USE_LOG needs OS_USE_UART"
+#endif
+
+#if POSTMORTEM_SWITCHES < 1 || (POSTMORTEM_SWITCHES & (POSTMORTEM_SWITCHES - 1)) != 0
+#error "POSTMORTEM_SWITCHES must be a power of 2"
+#endif
 
 /* typedef -------------------------------------------------------------------*/
 /**
@@ -80,7 +175,8 @@ typedef enum {
 	READY_STATE = 0,	/**< Task ready to run */
 	RUNNING_STATE,		/**< Task currently running */
 	BLOCKED_STATE,		/**< Task blocked by an OS API */
-	SUSPENDED_STATE		/**< Task suspended by an OS API */
+	SUSPENDED_STATE,	/**< Task suspended by an OS API */
+	DELETED_STATE		/**< Task deleted, its slot can be reused */
 } os_TaskState_e;
 
 /**
@@ -92,6 +188,16 @@ typedef enum {
 	IRQ_RUN_STATE,		/**< OS is running normally */
 } os_State_e;
 
+/**
+ * @brief OS error codes, the last one is kept in the control structure and
+ * 		  in the post-mortem snapshot.
+ */
+typedef enum {
+	OS_ERROR_NONE = 0,		/**< No error */
+	OS_ERROR_TASK_CREATE,	/**< Task creation failed, no free slot or invalid priority */
+	OS_ERROR_TASK_RETURN	/**< A task returned from its entry point */
+} os_ErrorCode_e;
+
 /**
  * @brief OS states.
  */
@@ -101,43 +207,149 @@ typedef enum {
 } os_Error_t;
 
 /**
- * @brief OS task parameters.
+ * @brief OS task scheduling parameters (hot data). Only the fields used by
+ * 		  the scheduler, the SysTick handler and the context switch, packed
+ * 		  in 16 bytes.
  */
 typedef struct {
-	uint32_t * stack;				/**< Pointer to task stack */
 	uint32_t sp;					/**< Task stack pointer */
+	uint32_t wakeTick;				/**< Tick when a blocked task times out */
+	uint8_t state;					/**< Task state (os_TaskState_e) */
+	uint8_t priority;				/**< Task priority */
+	uint8_t id;						/**< Task ID, index in the tasks tables */
+	uint8_t timerNext;				/**< Next task in the timeouts list */
+	uint8_t timerPrev;				/**< Previous task in the timeouts list */
+	uint8_t timeSlice;				/**< Time slice length in ticks, 0 disables slicing */
+	uint8_t ticksSlice;				/**< Ticks left in the current time slice */
+	uint8_t fpu;					/**< Task allowed to use the FPU */
+} os_Task_t;
+
+/**
+ * @brief OS task descriptive parameters (cold data).
+ */
+typedef struct {
+	uint32_t * stack;				/**< Pointer to task stack */
+	size_t stackSize;				/**< Task stack size in words */
+	os_Task_t ** waiter;			/**< Task field of the object the task is blocked on */
 	void * entryPoint;				/**< Pointer to code to execute */
-	uint32_t priority;				/**< Task priority */
 	char name[TASK_NAME_LEN + 1];	/**< Task name */
-	uint32_t id;					/**< Task ID */
-	os_TaskState_e state;			/**< Task state */
-	uint32_t ticksBlocked;			/**< Number of ticks that the task is blocked */
-} os_Task_t;
+} os_TaskInfo_t;
+
+/**
+ * @brief Post-mortem record of a context switch. The count orders the
+ * 		  records of the ring.
+ */
+typedef struct {
+	uint8_t from;		/**< ID of the outgoing task, TASK_NONE for main() */
+	uint8_t to;			/**< ID of the incoming task */
+	uint16_t count;		/**< Low 16 bits of the context switches counter */
+} os_PostMortemSwitch_t;
+
+/**
+ * @brief Post-mortem record of a task.
+ */
+typedef struct {
+	uint32_t sp;			/**< Stack pointer saved by its last switch */
+	uint8_t state;			/**< Task state (os_TaskState_e) */
+	uint8_t priority;		/**< Task priority */
+	uint16_t stackFree;		/**< Stack words never used (high-water mark) */
+} os_PostMortemTask_t;
+
+/**
+ * @brief Post-mortem snapshot, kept up to date while the OS runs. The
+ * 		  switches and the SP of the tasks are written by PendSV, the tick by
+ * 		  the SysTick, the rest by the idle task and when an error is
+ * 		  recorded.
+ */
+typedef struct {
+	uint32_t magic;										/**< POSTMORTEM_MAGIC if the snapshot is valid */
+	uint32_t boot;										/**< Boot number, increased on every os_Init() */
+	uint32_t tick;										/**< Last tick, low 32 bits */
+	uint32_t error;										/**< Last error (os_ErrorCode_e) */
+	uint32_t errorTick;									/**< Tick of the last error */
+	uint8_t errorTask;									/**< Task running at the last error, TASK_NONE if none */
+	uint8_t reserved[3];								/**< Padding */
+	os_PostMortemSwitch_t switches[POSTMORTEM_SWITCHES];	/**< Last context switches, indexed by their count */
+	os_PostMortemTask_t tasks[TASKS_MAX + 1];			/**< Tasks, the idle task is the last one */
+	void * caller;										/**< Caller of the last error */
+} os_PostMortem_t;
 
 /**
- * @brief OS control parameters.
+ * @brief OS control parameters. The first four fields are accessed by
+ * 		  PendSV_Handler.S at fixed offsets.
  */
 typedef struct {
-	os_Task_t tasksArray[TASKS_MAX];					/**< Array of tasks to execute */
-	uint32_t tasksStack[TASKS_MAX][STACK_SIZE_WORDS];	/**< Array of stacks for the tasks array */
-	uint8_t tasksNum;									/**< Number of tasks initialized in the tasks array */
-	os_Task_t taskIdle;									/**< Idle task */
+	os_Task_t * taskCurrent;							/**< Pointer to the current task running */
+	os_Task_t * taskNext;								/**< Pointer to the next task to run, selected by the scheduler */
+	uint32_t contextSwitches;							/**< Number of context switches done */
+	os_PostMortem_t * postMortem;						/**< Snapshot of this run, NULL if disabled */
+	os_Task_t resetTask;								/**< Current task of the first switch, takes the context of main() */
+	os_Task_t tasksArray[TASKS_MAX + 1];				/**< Hot tasks table, the idle task is the last one */
+	uint32_t readyMask[PRIORITY_LEVELS][READY_WORDS];	/**< Bitmap of tasks ready or running per priority */
+	uint32_t readyPriorities;							/**< Bitmap of priorities with tasks ready or running */
+	uint8_t lastRun[PRIORITY_LEVELS];					/**< Last task selected per priority (round-robin) */
+	uint8_t timerHead;									/**< First task of the timeouts list */
+	uint32_t tasksNum;									/**< Number of tasks alive in the tasks array */
+	os_TaskInfo_t tasksInfo[TASKS_MAX + 1];				/**< Cold tasks table */
 	uint32_t taskIdleStack[STACK_SIZE_WORDS];			/**< Idle task stack */
+	uint32_t resetFrame[FPU_TASK_STACK_MIN];			/**< Scratch PSP to save the context of main() on the first switch */
 	uint32_t error;										/**< Last error occurred in the OS */
 	os_State_e state;									/**< OS state */
 	bool doScheduling;									/**< Flag to do the schduling proccess */
-	os_Task_t * taskCurrent;							/**< Pointer to the current task running */
-	os_Task_t * taskNext;								/**< Pointer to the next task to run */
 	uint16_t criticalCounter;							/**< Critical section counter */
-	uint32_t tickCounter;								/**< OS tick counter */
+	uint64_t tickCounter;								/**< OS tick counter */
+	uint8_t postMortemTask;								/**< Next task refreshed in the snapshot by the idle task */
 } os_t;
 
+/**
+ * @brief Kernel object types.
+ */
+typedef enum {
+	OBJECT_SEMAPHORE = 0,		/**< Binary semaphore */
+	OBJECT_QUEUE,				/**< Queue */
+	OBJECT_PRIORITY_QUEUE		/**< Priority queue */
+} os_ObjectType_e;
+
+/**
+ * @brief Kernel object statistics. For a semaphore a send is a give and a
+ * 		  receive is a take.
+ */
+typedef struct {
+	uint32_t sends;			/**< Elements sent */
+	uint32_t receives;		/**< Elements received */
+	uint32_t sendFails;		/**< Sends failed because the object was full */
+	uint32_t receiveFails;	/**< Receives failed because the object was empty */
+	uint32_t peak;			/**< Max number of elements stored */
+	uint32_t blocks;		/**< Times a task blocked on the object */
+	uint32_t blockTime;		/**< Total ticks blocked */
+	uint32_t blockMax;		/**< Max ticks blocked */
+} os_ObjectStats_t;
+
+/**
+ * @brief Kernel object registry entry, embedded in each object.
+ */
+typedef struct os_Object_s {
+	const char * name;			/**< Object name, NULL if not set */
+	os_ObjectType_e type;		/**< Object type */
+	struct os_Object_s * next;	/**< Next object of the registry */
+	os_ObjectStats_t stats;		/**< Object statistics */
+} os_Object_t;
+
+/**
+ * @brief Queue set forward declaration.
+ */
+struct QueueSet_s;
+
 /**
  * @brief Semaphore control structure.
  */
 typedef struct {
-	os_Task_t * task;	/**< Task associated to semaphore */
-	bool isGiven;		/**< Variable to detemrine if task is given */
+	os_Task_t * task;			/**< Task associated to semaphore */
+	bool isGiven;				/**< Variable to detemrine if task is given */
+	struct QueueSet_s * set;	/**< Queue set that contains the semaphore */
+#if OBJECT_STATS
+	os_Object_t object;			/**< Registry entry and statistics */
+#endif
 } Semaphore_t;
 
 /**
@@ -156,20 +368,108 @@ typedef struct {
 	uint8_t data[QUEUE_SIZE_BYTES];	/**< Queue data array */
 	size_t size;					/**< Queue data size */
 	size_t len;						/**< Queue length (number of elements) */
-	size_t head;					/**< Queue index head */
-	size_t tail;					/**< Queue index tail */
+	size_t head;					/**< Element read next, modulo len */
+	size_t tail;					/**< Element written next, modulo len */
+	size_t count;					/**< Elements in the queue */
 	Queue_State_e state;			/**< Queue state */
 	os_Task_t * task;				/**< Task associated to queue */
+	size_t threshold;				/**< Elements needed to wake up the task blocked on the queue */
+	struct QueueSet_s * set;		/**< Queue set that contains the queue */
+#if OBJECT_STATS
+	os_Object_t object;				/**< Registry entry and statistics */
+#endif
 } Queue_t;
 
+/**
+ * @brief Queue set member types.
+ */
+typedef enum {
+	QUEUE_SET_QUEUE = 0,	/**< Member is a queue */
+	QUEUE_SET_SEMAPHORE		/**< Member is a binary semaphore */
+} QueueSet_Member_e;
+
+/**
+ * @brief Queue set member.
+ */
+typedef struct {
+	QueueSet_Member_e type;	/**< Member type */
+	void * handle;			/**< Pointer to the queue or semaphore */
+} QueueSet_Member_t;
+
+/**
+ * @brief Queue set control structure.
+ */
+typedef struct QueueSet_s {
+	QueueSet_Member_t members[QUEUE_SET_SIZE];	/**< Members of the set */
+	size_t len;									/**< Number of members in the set */
+	size_t last;								/**< Index of the last member selected */
+	os_Task_t * task;							/**< Task blocked on the set */
+} QueueSet_t;
+
+/**
+ * @brief Priority queue control structure. The elements are kept in one
+ * 		  FIFO list per priority, linked by slot index.
+ */
+typedef struct {
+	uint8_t data[QUEUE_SIZE_BYTES];		/**< Queue data array */
+	size_t size;						/**< Queue data size */
+	size_t len;							/**< Queue length (number of elements) */
+	uint8_t next[QUEUE_SIZE_BYTES];		/**< Next slot of each slot in its list */
+	uint8_t head[QUEUE_PRIORITIES];		/**< First slot of each priority */
+	uint8_t tail[QUEUE_PRIORITIES];		/**< Last slot of each priority */
+	uint8_t free;						/**< First free slot */
+	uint32_t priorities;				/**< Bitmap of priorities with elements */
+	os_Task_t * task;					/**< Task associated to queue */
+#if OBJECT_STATS
+	os_Object_t object;					/**< Registry entry and statistics */
+#endif
+} PriorityQueue_t;
+
 /**
  * @brief Queue control structure.
  */
 typedef struct {
 	void (* handler)(void *);	/**< ISR handler */
 	void * arg;					/**< ISR handler argument */
+#if OS_USE_IRQ_RATE_LIMIT
+	uint8_t coalesce;			/**< Index in the rate limiting table, IRQ_COALESCE_NONE if disabled */
+#endif
 } ISR_t;
 
+/**
+ * @brief Events merged in a delivery of a rate limited IRQ.
+ */
+typedef struct {
+	uint32_t count;		/**< Number of events */
+	uint32_t first;		/**< Timestamp of the first event in us */
+	uint32_t last;		/**< Timestamp of the last event in us */
+} os_IRQEvents_t;
+
+/**
+ * @brief Overload counters of a rate limited IRQ.
+ */
+typedef struct {
+	uint32_t delivered;	/**< Calls to the handler */
+	uint32_t merged;	/**< Events merged into a later call */
+	uint32_t masked;	/**< Times the IRQ was masked until the end of a window */
+} os_IRQStats_t;
+
+/**
+ * @brief Rate limiting control structure. The handler is called at most
+ * 		  once per window, the events in between are merged.
+ */
+typedef struct {
+	void (* ack)(void *);		/**< Clears the IRQ source of a merged event, NULL masks the IRQ instead */
+	uint32_t window;			/**< Window length in ticks */
+	uint32_t windowEnd;			/**< Tick when the current window ends */
+	uint8_t irq;				/**< IRQ number */
+	bool open;					/**< Window in progress */
+	bool deliver;				/**< Delivery of the merged events pended */
+	os_IRQEvents_t pending;		/**< Events merged in the current window */
+	os_IRQEvents_t events;		/**< Events of the current delivery */
+	os_IRQStats_t stats;		/**< Overload counters */
+} os_IRQCoalesce_t;
+
 /* external data declaration -------------------------------------------------*/
 
 /* OS API */
@@ -184,7 +484,7 @@ os_Error_t os_Init(void);
  * @brief OS task creation function.
  * @param task
  * @param name
- * @param priority
+ * @param priority lower than PRIORITY_LEVELS, not PRIORITY_RESERVED
  * @param arg
  * @return - OS_OK: successful
  * 		   - OS_FAIL: fail
@@ -192,12 +492,83 @@ os_Error_t os_Init(void);
 os_Error_t os_CreateTask(void * task, const char * name, uint32_t priority, void * arg);
 
 /**
- * @brief OS task deletion function.
+ * @brief OS task creation function with a stack provided by the caller.
+ * @param task
+ * @param name
+ * @param priority lower than PRIORITY_LEVELS, not PRIORITY_RESERVED
+ * @param arg
+ * @param stack 8 bytes aligned
+ * @param words stack size in words, TASK_STACK_MIN or more
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t os_CreateTaskStatic(void * task, const char * name, uint32_t priority, void * arg, uint32_t * stack, size_t words);
+
+/**
+ * @brief OS task creation function for a task that uses the FPU. The tasks
+ * 		  created by the other functions are integer only: with OS_FPU_TRAP
+ * 		  a floating point instruction in them raises a UsageFault, so the
+ * 		  switches to and from them never save the FPU registers.
+ * @param task
+ * @param name
+ * @param priority lower than PRIORITY_LEVELS, not PRIORITY_RESERVED
+ * @param arg
+ * @param stack 8 bytes aligned, NULL to use the stack of the task slot
+ * @param words stack size in words, FPU_TASK_STACK_MIN or more
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t os_CreateTaskFpu(void * task, const char * name, uint32_t priority, void * arg, uint32_t * stack, size_t words);
+
+#if OS_USE_CYCLIC
+/**
+ * @brief OS task creation function for the task of the cyclic executive,
+ * 		  the only one with the priority PRIORITY_RESERVED.
+ * @param task
+ * @param name
+ * @param arg
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, a task with the reserved priority already exists
+ */
+os_Error_t os_CreateTaskReserved(void * task, const char * name, void * arg);
+#endif
+
+#if OS_USE_TASK_CONTROL
+/**
+ * @brief OS task deletion function. The slot and the stack of the task are
+ * 		  reused by the next task created. A task blocked on a queue, a
+ * 		  semaphore or a queue set is released from it.
+ * @param id
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t os_DeleteTask(uint32_t id);
+
+/**
+ * @brief OS task suspension function. A task suspended while blocked returns
+ * 		  from the blocking call as if it timed out once it is resumed.
  * @param id
  * @return - OS_OK: successful
  * 		   - OS_FAIL: fail
  */
-os_Error_t os_DeleteTask(uint32_t id);	/* todo: implement */
+os_Error_t os_SuspendTask(uint32_t id);
+
+/**
+ * @brief OS task resumption function.
+ * @param id
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, the task is not suspended
+ */
+os_Error_t os_ResumeTask(uint32_t id);
+#endif
+
+/**
+ * @brief OS function to get the ID of the running task.
+ * @param id
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t os_GetTaskId(uint32_t * id);
 
 /**
  * @brief OS scheduler start.
@@ -226,6 +597,7 @@ os_Error_t os_EnterCritical(void);
  */
 os_Error_t os_ExitCritical(void);
 
+#if OS_USE_IRQS
 /**
  * @brief OS API to install an IRQ services.
  * @param irq
@@ -243,6 +615,41 @@ os_Error_t os_InstallIRQ(LPC43XX_IRQn_Type irq, void * isr, void * arg);
  * 		   - OS_FAIL: fail
  */
 os_Error_t os_UninstallIRQ(LPC43XX_IRQn_Type irq);
+#endif
+
+#if OS_USE_IRQ_RATE_LIMIT
+/**
+ * @brief OS API to limit the rate of an IRQ. The first event calls the
+ * 		  handler and opens a window; the events inside the window are merged
+ * 		  and delivered in one call when it ends.
+ * @param irq
+ * @param ticks window length, 0 disables the rate limiting
+ * @param ack function to clear the IRQ source of the merged events, with the
+ * 		  handler argument. If NULL the IRQ is masked until the window ends
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t os_SetIRQRateLimit(LPC43XX_IRQn_Type irq, uint32_t ticks, void * ack);
+
+/**
+ * @brief OS API to get the events of the current delivery of a rate limited
+ * 		  IRQ, called from its handler.
+ * @param irq
+ * @param events
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t os_GetIRQEvents(LPC43XX_IRQn_Type irq, os_IRQEvents_t * events);
+
+/**
+ * @brief OS API to get the overload counters of a rate limited IRQ.
+ * @param irq
+ * @param stats
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t os_GetIRQStats(LPC43XX_IRQn_Type irq, os_IRQStats_t * stats);
+#endif
 
 /**
  * @brief OS API to delay and block task.
@@ -253,15 +660,141 @@ os_Error_t os_UninstallIRQ(LPC43XX_IRQn_Type irq);
 os_Error_t os_TaskDelay(uint32_t ticks);
 
 /**
- * @brief OS API to delay and block task.
+ * @brief OS API to block a task until a periodic wake tick, without drift.
+ * @param wake last wake tick, updated to the next one
+ * @param ticks period
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, the next wake tick already passed (overrun)
+ */
+os_Error_t os_TaskDelayUntil(uint32_t * wake, uint32_t ticks);
+
+/**
+ * @brief OS API to get the tick counter.
  * @param ticks
  * @return - OS_OK: successful
  * 		   - OS_FAIL: fail
  */
 os_Error_t os_GetTickCounter(uint32_t * ticks);
 
+/**
+ * @brief OS API to get the 64-bit tick counter. It never wraps and can be
+ * 		  called from tasks and ISRs.
+ * @param ticks
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t os_GetTickCounter64(uint64_t * ticks);
+
+/**
+ * @brief OS API to get the CPU cycles elapsed since the scheduler started.
+ * 		  Combines the tick counter with the SysTick current value register,
+ * 		  so the resolution is one core clock cycle. It can be called from
+ * 		  tasks and ISRs.
+ * @param cycles
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t os_GetCycles(uint64_t * cycles);
+
+/**
+ * @brief OS API to get the microseconds elapsed since the scheduler started.
+ * 		  It can be called from tasks and ISRs.
+ * @param us
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t os_GetTimeUs(uint64_t * us);
+
+/**
+ * @brief OS API to set the time slice of the calling task. Tasks with the
+ * 		  same priority rotate only when the slice is used up, when they
+ * 		  block or when they yield. A value of 0 disables the slicing
+ * 		  (cooperative mode) for the task. Max value is 255 ticks.
+ * @param ticks
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t os_SetTimeSlice(uint32_t ticks);
+
+/**
+ * @brief OS API to get the number of context switches done since the
+ * 		  scheduler started.
+ * @param switches
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t os_GetContextSwitches(uint32_t * switches);
+
+/**
+ * @brief OS API to get the last error occurred.
+ * @param error os_ErrorCode_e
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t os_GetError(uint32_t * error);
+
+#if OS_USE_POSTMORTEM
+/**
+ * @brief OS API to get the post-mortem snapshot left by the previous run,
+ * 		  e.g. after a watchdog reset. It is kept until the next os_Init().
+ * @param snapshot
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, there is no valid snapshot
+ */
+os_Error_t os_GetPostMortem(os_PostMortem_t * snapshot);
+
+/**
+ * @brief OS API to refresh the state, priority and stack high-water mark of
+ * 		  the next task of the snapshot. It is called in the loop of the idle
+ * 		  task, an idleTask() of the application calls it too.
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t os_UpdatePostMortem(void);
+#endif
+
+#if OBJECT_STATS
+/* Statistics API */
+
+/**
+ * @brief OS API to name a kernel object, e.g. os_SetObjectName(&queue.object,
+ * 		  "queue").
+ * @param object
+ * @param name
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t os_SetObjectName(os_Object_t * object, const char * name);
+
+/**
+ * @brief OS API to enumerate the kernel objects initialized.
+ * @param object NULL to get the first one, then the previous one returned
+ * @return next object, NULL at the end of the registry
+ */
+os_Object_t * os_GetNextObject(os_Object_t * object);
+
+/**
+ * @brief OS API to read the statistics of a kernel object.
+ * @param object
+ * @param stats
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t os_GetObjectStats(os_Object_t * object, os_ObjectStats_t * stats);
+
+/**
+ * @brief OS API to remove a kernel object from the registry, before its
+ * 		  memory is reused.
+ * @param object
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, the object is not registered
+ */
+os_Error_t os_RemoveObject(os_Object_t * object);
+#endif
+
 /* Synchronization API */
 
+#if OS_USE_SEMAPHORES
 /**
  * @brief OS API to create a semaphore (binary).
  * @param me
@@ -278,6 +811,23 @@ os_Error_t Semaphore_Init(Semaphore_t * const me);
  */
 os_Error_t Semaphore_Take(Semaphore_t * const me);
 
+/**
+ * @brief OS API to take a binary semaphore with a timeout.
+ * @param me
+ * @param ticks
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, not given before the timeout
+ */
+os_Error_t Semaphore_TakeTimeout(Semaphore_t * const me, uint32_t ticks);
+
+/**
+ * @brief OS API to take a binary semaphore without blocking.
+ * @param me
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, the semaphore is not given
+ */
+os_Error_t Semaphore_TryTake(Semaphore_t * const me);
+
 /**
  * @brief OS API to give a binary semaphore.
  * @param me
@@ -285,11 +835,13 @@ os_Error_t Semaphore_Take(Semaphore_t * const me);
  * 		   - OS_FAIL: fail
  */
 os_Error_t Semaphore_Give(Semaphore_t * const me);
+#endif
 
+#if OS_USE_QUEUES
 /**
  * @brief OS API to create a queue.
  * @param me
- * @param size
+ * @param size size of an element, between 1 and QUEUE_SIZE_BYTES
  * @return - OS_OK: successful
  * 		   - OS_FAIL: fail
  */
@@ -308,12 +860,125 @@ os_Error_t Queue_Send(Queue_t * const me, void * data);
  * @brief OS API to receive/read data from a queue.
  * @param me
  * @param data
- * @param ticks
+ * @param ticks 0 to return right away if the queue is empty
  * @return - OS_OK: successful
- * 		   - OS_FAIL: fail
+ * 		   - OS_FAIL: fail, no data received before the timeout
  */
 os_Error_t Queue_Receive(Queue_t * const me, void * data, uint32_t ticks);
 
+/**
+ * @brief OS API to send/write several elements into a queue with one copy
+ * 		  and at most one wakeup.
+ * @param me
+ * @param data
+ * @param count number of elements to send
+ * @param sent number of elements sent, can be NULL
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, not all the elements fit in the queue
+ */
+os_Error_t Queue_SendMany(Queue_t * const me, const void * data, size_t count, size_t * sent);
+
+/**
+ * @brief OS API to receive/read several elements from a queue with one copy.
+ * 		  The task blocks until at least min elements are available.
+ * @param me
+ * @param data
+ * @param count max number of elements to receive
+ * @param min elements to wait for, 0 is taken as 1. More than count or
+ * 		  than the length of the queue is an error
+ * @param received number of elements received, can be NULL
+ * @param ticks 0 to return right away with the elements available
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, less than min elements received before the timeout
+ */
+os_Error_t Queue_ReceiveMany(Queue_t * const me, void * data, size_t count, size_t min, size_t * received, uint32_t ticks);
+#endif
+
+#if OS_USE_PRIORITY_QUEUES
+/**
+ * @brief OS API to create a priority queue.
+ * @param me
+ * @param size
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t PriorityQueue_Init(PriorityQueue_t * const me, size_t size);
+
+/**
+ * @brief OS API to send/write data into a priority queue. Never blocks, can
+ * 		  be called from ISRs.
+ * @param me
+ * @param data
+ * @param priority lower than QUEUE_PRIORITIES
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, the queue is full
+ */
+os_Error_t PriorityQueue_Send(PriorityQueue_t * const me, void * data, uint32_t priority);
+
+/**
+ * @brief OS API to receive/read the oldest element with the highest priority
+ * 		  from a priority queue.
+ * @param me
+ * @param data
+ * @param ticks 0 to return right away if the queue is empty
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, no data received before the timeout
+ */
+os_Error_t PriorityQueue_Receive(PriorityQueue_t * const me, void * data, uint32_t ticks);
+#endif
+
+#if OS_USE_QUEUE_SETS
+/**
+ * @brief OS API to create a queue set.
+ * @param me
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t QueueSet_Init(QueueSet_t * const me);
+
+/**
+ * @brief OS API to add a queue to a queue set. A queue can be member of
+ * 		  only one set.
+ * @param me
+ * @param queue
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t QueueSet_AddQueue(QueueSet_t * const me, Queue_t * const queue);
+
+/**
+ * @brief OS API to add a binary semaphore to a queue set. A semaphore can be
+ * 		  member of only one set.
+ * @param me
+ * @param semaphore
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t QueueSet_AddSemaphore(QueueSet_t * const me, Semaphore_t * const semaphore);
+
+/**
+ * @brief OS API to remove a queue or a semaphore from a queue set.
+ * @param me
+ * @param member
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t QueueSet_Remove(QueueSet_t * const me, void * member);
+
+/**
+ * @brief OS API to wait until any member of a queue set is ready. A queue is
+ * 		  ready when it has data and a semaphore when it is given. The ready
+ * 		  member must be read next with Queue_Receive() or Semaphore_Take(),
+ * 		  which will not block.
+ * @param me
+ * @param member pointer to the queue or semaphore ready
+ * @param ticks
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, no member ready before the timeout
+ */
+os_Error_t QueueSet_Select(QueueSet_t * const me, void ** member, uint32_t ticks);
+#endif
+
 /**
  * @brief Hook de retorno de tareas
  * @details Esta funcion no deberia accederse bajo ningun concepto, porque
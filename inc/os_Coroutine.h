@@ -0,0 +1,181 @@
+/*
+ * os_Coroutine.h
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+#ifndef _OS_COROUTINE_H_
+#define _OS_COROUTINE_H_
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Core.h"
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* macros --------------------------------------------------------------------*/
+
+#define COROUTINE_PERIOD	1	/**< Ticks the host task sleeps when no coroutine made progress */
+
+/*
+ * Stackless coroutines (protothreads). A coroutine is a function that is
+ * called again and again by the host task and resumes at the last await
+ * point. Local variables are not kept between calls, so the state must live
+ * in the argument or in static variables. The await macros can not be used
+ * inside a switch statement and only one can be used per source line.
+ */
+
+/**
+ * @brief Start of the coroutine body.
+ */
+#define CO_BEGIN(co)	switch((co)->line) { case 0:
+
+/**
+ * @brief End of the coroutine body. The coroutine is removed from its
+ * 		  scheduler.
+ */
+#define CO_END(co)		} (co)->line = 0; (co)->state = COROUTINE_DONE_STATE; return
+
+/**
+ * @brief Wait until the condition is true.
+ */
+#define CO_AWAIT(co, cond)	do {										\
+								(co)->line = __LINE__; case __LINE__:	\
+								if(!(cond)) {							\
+									return;								\
+								}										\
+							} while(0)
+
+/**
+ * @brief Let the other coroutines run.
+ */
+#define CO_YIELD(co)	do {										\
+							(co)->state = COROUTINE_YIELD_STATE;	\
+							(co)->line = __LINE__; case __LINE__:	\
+							if((co)->state == COROUTINE_YIELD_STATE) {	\
+								return;								\
+							}										\
+						} while(0)
+
+/**
+ * @brief Wait the number of ticks given.
+ */
+#define CO_DELAY(co, ticks)	do {												\
+								(co)->wakeTick = Coroutine_Now() + (ticks);		\
+								CO_AWAIT(co, !TICKS_AFTER((co)->wakeTick, Coroutine_Now()));	\
+							} while(0)
+
+/**
+ * @brief Wait until data is received from the queue.
+ */
+#define CO_QUEUE_RECEIVE(co, queue, data)	CO_AWAIT(co, Queue_Receive(queue, data, 0) == OS_OK)
+
+/**
+ * @brief Wait until data is sent to the queue.
+ */
+#define CO_QUEUE_SEND(co, queue, data)	CO_AWAIT(co, Queue_Send(queue, data) == OS_OK)
+
+/**
+ * @brief Wait until the binary semaphore is taken.
+ */
+#define CO_SEMAPHORE_TAKE(co, semaphore)	CO_AWAIT(co, Semaphore_TryTake(semaphore) == OS_OK)
+
+/* typedef -------------------------------------------------------------------*/
+
+/**
+ * @brief Coroutine states.
+ */
+typedef enum {
+	COROUTINE_RUN_STATE = 0,	/**< Coroutine running or waiting in an await */
+	COROUTINE_YIELD_STATE,		/**< Coroutine gave up the CPU until the next pass */
+	COROUTINE_DONE_STATE		/**< Coroutine ended */
+} Coroutine_State_e;
+
+/**
+ * @brief Coroutine control structure.
+ */
+typedef struct Coroutine_s {
+	void (* function)(struct Coroutine_s * const);	/**< Coroutine body */
+	void * arg;										/**< Coroutine argument */
+	struct Coroutine_s * next;						/**< Next coroutine of the scheduler */
+	uint32_t wakeTick;								/**< Tick to resume a delay */
+	uint16_t line;									/**< Resume point */
+	uint8_t state;									/**< Coroutine state (Coroutine_State_e) */
+} Coroutine_t;
+
+/**
+ * @brief Coroutine body type.
+ */
+typedef void (* Coroutine_Function_t)(Coroutine_t * const me);
+
+/**
+ * @brief Coroutines scheduler control structure.
+ */
+typedef struct {
+	Coroutine_t * head;	/**< First coroutine */
+	Coroutine_t * tail;	/**< Last coroutine */
+} CoScheduler_t;
+
+/* external data declaration -------------------------------------------------*/
+
+/* external functions declaration --------------------------------------------*/
+
+/**
+ * @brief Coroutine initialization.
+ * @param me
+ * @param function
+ * @param arg
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t Coroutine_Init(Coroutine_t * const me, Coroutine_Function_t function, void * arg);
+
+/**
+ * @brief Get the tick counter, used by the await macros.
+ * @return tick counter
+ */
+uint32_t Coroutine_Now(void);
+
+/**
+ * @brief Coroutines scheduler initialization.
+ * @param me
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t CoScheduler_Init(CoScheduler_t * const me);
+
+/**
+ * @brief Add a coroutine to a scheduler. Must be called from the host task
+ * 		  or before it starts.
+ * @param me
+ * @param coroutine
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t CoScheduler_Add(CoScheduler_t * const me, Coroutine_t * const coroutine);
+
+/**
+ * @brief Coroutines host task. Runs all the coroutines of the scheduler
+ * 		  passed as argument in a single OS task and stack. When no
+ * 		  coroutine made progress the task sleeps COROUTINE_PERIOD ticks.
+ * @param arg pointer to a CoScheduler_t instance
+ * @return none
+ */
+void CoScheduler_Task(void * arg);
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} doxygen end group definition */
+
+/* end of file ---------------------------------------------------------------*/
+
+#endif /* #ifndef _OS_COROUTINE_H_ */
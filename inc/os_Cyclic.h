@@ -0,0 +1,109 @@
+/*
+ * os_Cyclic.h
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+#ifndef _OS_CYCLIC_H_
+#define _OS_CYCLIC_H_
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Core.h"
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* macros --------------------------------------------------------------------*/
+
+/*
+ * Time-triggered cyclic executive. A static table says which jobs run in each
+ * minor frame; the frames run in a task woken up by the SysTick at the start
+ * of each frame, with the highest priority reserved to it and without time
+ * slicing, so the event-driven tasks only run in the slack left by the
+ * table. A frame that is not finished when the
+ * next one must start is an overrun: it is counted, reported to
+ * cyclicOverrunHook() and the frames whose start already passed are skipped,
+ * so the table stays aligned with the time.
+ */
+
+#define CYCLIC_PRIORITY		PRIORITY_RESERVED	/**< Priority of the cyclic executive task, no other task has it */
+
+/* Build-time check of a minor frame: the sum of the WCET in us of its jobs
+ * must fit in the frame */
+#define CYCLIC_ASSERT_FRAME(wcet, frameTicks) \
+		_Static_assert((wcet) <= (frameTicks) * SYSTICK_TIME, "Cyclic minor frame overloaded")
+
+/* typedef -------------------------------------------------------------------*/
+
+/**
+ * @brief Cyclic executive job.
+ */
+typedef struct {
+	void (* job)(void *);	/**< Function to execute, must not block */
+	void * arg;				/**< Function argument */
+	uint32_t wcet;			/**< Worst case execution time in us */
+} Cyclic_Job_t;
+
+/**
+ * @brief Cyclic executive minor frame.
+ */
+typedef struct {
+	const Cyclic_Job_t * jobs;	/**< Jobs of the frame, executed in order */
+	size_t len;					/**< Number of jobs */
+} Cyclic_Frame_t;
+
+/**
+ * @brief Cyclic executive control structure.
+ */
+typedef struct {
+	const Cyclic_Frame_t * table;	/**< Minor frames of the major cycle */
+	size_t frames;					/**< Number of minor frames */
+	uint32_t frameTicks;			/**< Minor frame length in ticks */
+	size_t frame;					/**< Next frame to execute */
+	uint32_t wake;					/**< Start tick of the next frame */
+	uint32_t overruns;				/**< Frames not finished in time */
+	uint32_t skipped;				/**< Frames not executed because of an overrun */
+	uint32_t maxTime;				/**< Max execution time of a frame in us */
+} Cyclic_t;
+
+/* external data declaration -------------------------------------------------*/
+
+/* external functions declaration --------------------------------------------*/
+
+/**
+ * @brief Cyclic executive start. Checks the utilization of each frame with
+ * 		  the WCET of its jobs and creates the executive task, only one
+ * 		  executive can run.
+ * @param me
+ * @param table
+ * @param frames
+ * @param frameTicks
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t Cyclic_Start(Cyclic_t * const me, const Cyclic_Frame_t * table, size_t frames, uint32_t frameTicks);
+
+/**
+ * @brief Overrun hook, called from the executive task with the frame that
+ * 		  was late.
+ * @param me
+ * @param frame
+ */
+void __attribute__((weak)) cyclicOverrunHook(Cyclic_t * const me, size_t frame);
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} doxygen end group definition */
+
+/* end of file ---------------------------------------------------------------*/
+
+#endif /* #ifndef _OS_CYCLIC_H_ */
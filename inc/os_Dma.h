@@ -0,0 +1,85 @@
+/*
+ * os_Dma.h
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+#ifndef _OS_DMA_H_
+#define _OS_DMA_H_
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Core.h"
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* macros --------------------------------------------------------------------*/
+
+#define DMA_CHANNELS_NUM	8	/**< Number of GPDMA channels */
+
+/* typedef -------------------------------------------------------------------*/
+
+/**
+ * @brief DMA channel callback. Called from the DMA ISR when a transfer of the
+ * 		  channel ends.
+ * @param arg argument registered with the channel
+ * @param ok true if the transfer was completed, false on error
+ */
+typedef void (* Dma_Callback_t)(void * arg, bool ok);
+
+/**
+ * @brief DMA channel control structure.
+ */
+typedef struct {
+	Dma_Callback_t callback;	/**< Transfer end callback */
+	void * arg;					/**< Callback argument */
+} Dma_Channel_t;
+
+/* external data declaration -------------------------------------------------*/
+
+/* external functions declaration --------------------------------------------*/
+
+/**
+ * @brief DMA initialization function. Initializes the GPDMA controller and
+ * 		  installs the DMA ISR in the OS, which dispatches the channels
+ * 		  interrupts to its callbacks. Can be called more than once.
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t Dma_Init(void);
+
+/**
+ * @brief DMA API to get a free channel for a peripheral connection.
+ * @param peripheral GPDMA peripheral connection (GPDMA_CONN_xxx)
+ * @param callback
+ * @param arg
+ * @param channel
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t Dma_Open(uint32_t peripheral, Dma_Callback_t callback, void * arg, uint8_t * channel);
+
+/**
+ * @brief DMA API to stop and release a channel.
+ * @param channel
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t Dma_Close(uint8_t channel);
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} doxygen end group definition */
+
+/* end of file ---------------------------------------------------------------*/
+
+#endif /* #ifndef _OS_DMA_H_ */
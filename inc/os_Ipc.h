@@ -0,0 +1,130 @@
+/*
+ * os_Ipc.h
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+#ifndef _OS_IPC_H_
+#define _OS_IPC_H_
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Core.h"
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* macros --------------------------------------------------------------------*/
+
+/*
+ * Inter-core calls between the Cortex-M4 (this kernel) and the Cortex-M0APP.
+ * Each direction is a ring with a single producer and a single consumer in
+ * shared memory; after writing a message the producer executes SEV, the
+ * doorbell that raises the interrupt of the other core. The M4 tasks send
+ * requests and block until the response arrives; the M0 runs a dispatcher
+ * that serves the requests one at a time (build it with CORE_M0 defined).
+ */
+
+#define IPC_RING_LEN		16			/**< Messages of each ring, power of 2 */
+#define IPC_PENDING_MAX		8			/**< Max calls waiting for a response */
+#define IPC_SECTION			".bss.$RamAHB16"	/**< Shared memory section, same address in both images */
+#define IPC_READY			0x4D30AA55	/**< Value set by the M0 when it is serving */
+
+/* typedef -------------------------------------------------------------------*/
+
+/**
+ * @brief Inter-core message.
+ */
+typedef struct {
+	uint32_t id;		/**< Call ID, generation and pending slot */
+	uint32_t command;	/**< Command to execute */
+	uint32_t arg;		/**< Command argument */
+	uint32_t result;	/**< Command result, only in the responses */
+} Ipc_Message_t;
+
+/**
+ * @brief Inter-core ring, one producer core and one consumer core.
+ */
+typedef struct {
+	Ipc_Message_t messages[IPC_RING_LEN];	/**< Messages storage */
+	volatile uint32_t head;					/**< Messages read, only written by the consumer */
+	volatile uint32_t tail;					/**< Messages written, only written by the producer */
+} Ipc_Ring_t;
+
+/**
+ * @brief Shared memory of the two cores.
+ */
+typedef struct {
+	Ipc_Ring_t requests;		/**< M4 to M0 */
+	Ipc_Ring_t responses;		/**< M0 to M4 */
+	volatile uint32_t ready;	/**< IPC_READY when the M0 is serving */
+} Ipc_Shared_t;
+
+/**
+ * @brief M0 command handler type.
+ */
+typedef uint32_t (* Ipc_Handler_t)(uint32_t command, uint32_t arg);
+
+/* external data declaration -------------------------------------------------*/
+
+/* external functions declaration --------------------------------------------*/
+
+#ifndef CORE_M0
+
+/**
+ * @brief Inter-core initialization on the M4. Must be called before the M0
+ * 		  starts.
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t Ipc_Init(void);
+
+/**
+ * @brief Start the M0 core and wait until its dispatcher is serving. Must be
+ * 		  called from a task.
+ * @param image address of the M0 image, 4 KB aligned
+ * @param ticks max time to wait for the dispatcher
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, the M0 was not serving before the timeout
+ */
+os_Error_t Ipc_StartM0(const void * image, uint32_t ticks);
+
+/**
+ * @brief Inter-core API to execute a command on the M0. The task blocks
+ * 		  until the response arrives.
+ * @param command
+ * @param arg
+ * @param result can be NULL
+ * @param ticks
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, the M0 is not serving, no free slot or no response
+ * 		     before the timeout
+ */
+os_Error_t Ipc_Call(uint32_t command, uint32_t arg, uint32_t * result, uint32_t ticks);
+
+#else
+
+/**
+ * @brief Inter-core dispatcher on the M0. Executes the requests of the M4
+ * 		  with the handler and sleeps between them, never returns.
+ * @param handler
+ */
+void Ipc_Serve(Ipc_Handler_t handler);
+
+#endif
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} doxygen end group definition */
+
+/* end of file ---------------------------------------------------------------*/
+
+#endif /* #ifndef _OS_IPC_H_ */
@@ -0,0 +1,107 @@
+/*
+ * os_Log.h
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+#ifndef _OS_LOG_H_
+#define _OS_LOG_H_
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include <stdarg.h>
+#include "os_Core.h"
+#include "os_Uart.h"
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* macros --------------------------------------------------------------------*/
+
+#define LOG_RECORDS			32		/**< Number of records in the ring, power of 2 */
+#define LOG_ARGS_MAX		4		/**< Max number of arguments per record */
+#define LOG_FRAME_SYNC		0xA5	/**< First byte of each record sent */
+
+/* Count the variadic arguments (0 to LOG_ARGS_MAX) */
+#define LOG_NARGS_(_0, _1, _2, _3, _4, n, ...)	n
+#define LOG_NARGS(...)	LOG_NARGS_(_0, ##__VA_ARGS__, 4, 3, 2, 1, 0)
+
+/**
+ * @brief Log a message. Only the address of the format string and the raw
+ * 		  arguments are stored, the message is formatted on the host with
+ * 		  tools/log_decode.py and the ELF file. Arguments must be integers,
+ * 		  characters or pointers to constant strings (%s), up to
+ * 		  LOG_ARGS_MAX. Can be used from tasks and ISRs.
+ */
+#define LOG(fmt, ...)	Log_Write(fmt, LOG_NARGS(__VA_ARGS__), ##__VA_ARGS__)
+
+/* typedef -------------------------------------------------------------------*/
+
+/**
+ * @brief Log record.
+ */
+typedef struct {
+	volatile uint32_t seq;		/**< Sequence number + 1, written last to commit the record */
+	uint32_t id;				/**< Format string address */
+	uint32_t timestamp;			/**< Lower 32 bits of the CPU cycles counter */
+	uint32_t nargs;				/**< Number of arguments */
+	uint32_t args[LOG_ARGS_MAX];	/**< Raw arguments */
+} Log_Record_t;
+
+/**
+ * @brief Log control structure. It is a global symbol (logBuffer), so a
+ * 		  debugger can also read the records.
+ */
+typedef struct {
+	Log_Record_t records[LOG_RECORDS];	/**< Records ring */
+	volatile uint32_t head;				/**< Next record to write */
+	volatile uint32_t tail;				/**< Next record to read */
+	volatile uint32_t dropped;			/**< Records dropped because the ring was full */
+} Log_t;
+
+/* external data declaration -------------------------------------------------*/
+
+extern Log_t logBuffer;
+
+/* external functions declaration --------------------------------------------*/
+
+/**
+ * @brief Log API to store a record. Use the LOG() macro instead.
+ * @param fmt
+ * @param nargs
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, the ring is full
+ */
+os_Error_t Log_Write(const char * fmt, uint32_t nargs, ...);
+
+/**
+ * @brief Log API to read the oldest record. Only one reader is allowed.
+ * @param record
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, the ring is empty
+ */
+os_Error_t Log_Read(Log_Record_t * record);
+
+/**
+ * @brief Log task. Sends the records in binary form through the UART
+ * 		  driver passed as argument. Create it with a low priority.
+ * @param arg pointer to a Uart_t instance
+ * @return none
+ */
+void Log_Task(void * arg);
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} doxygen end group definition */
+
+/* end of file ---------------------------------------------------------------*/
+
+#endif /* #ifndef _OS_LOG_H_ */
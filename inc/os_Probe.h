@@ -0,0 +1,138 @@
+/*
+ * os_Probe.h
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+#ifndef _OS_PROBE_H_
+#define _OS_PROBE_H_
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Core.h"
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* macros --------------------------------------------------------------------*/
+
+/*
+ * Latency probes. A start timestamp is taken where the chain begins (an ISR,
+ * a task) and travels with the data; where the chain ends the latency is
+ * recorded in a histogram with log2 buckets of us: the bucket n holds the
+ * latencies from 2^(n-1) to 2^n - 1 us, the bucket 0 the latencies of 0 us.
+ * A latency over the budget of the probe is a deadline miss.
+ */
+
+#define PROBE_BUCKETS		24			/**< Histogram buckets, the last one holds all the longer latencies */
+#define PROBE_EXPORT_MAGIC	0x50		/**< First byte of an exported histogram */
+#define PROBE_EXPORT_SIZE	(22 + PROBE_BUCKETS * 5)	/**< Max size of an exported histogram */
+
+/* typedef -------------------------------------------------------------------*/
+
+/**
+ * @brief Latency probe control structure.
+ */
+typedef struct {
+	const char * name;					/**< Probe name */
+	uint32_t budget;					/**< Deadline in us, 0 disables the watch */
+	uint32_t start;						/**< Timestamp of Probe_Start */
+	uint32_t count;						/**< Latencies recorded */
+	uint32_t min;						/**< Min latency in us */
+	uint32_t max;						/**< Max latency in us */
+	uint32_t misses;					/**< Latencies over the budget */
+	uint32_t buckets[PROBE_BUCKETS];	/**< Histogram */
+} Probe_t;
+
+/* external data declaration -------------------------------------------------*/
+
+/* external functions declaration --------------------------------------------*/
+
+/**
+ * @brief Latency probe initialization.
+ * @param me
+ * @param name
+ * @param budget deadline in us, 0 disables the watch
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t Probe_Init(Probe_t * const me, const char * name, uint32_t budget);
+
+/**
+ * @brief Latency probe timestamp, to mark the start of a chain. Can be
+ * 		  called from ISRs.
+ * @return timestamp in us
+ */
+uint32_t Probe_Now(void);
+
+/**
+ * @brief Latency probe API to record the latency from a start timestamp.
+ * 		  Can be called from ISRs.
+ * @param me
+ * @param start timestamp returned by Probe_Now
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, deadline missed
+ */
+os_Error_t Probe_Record(Probe_t * const me, uint32_t start);
+
+/**
+ * @brief Latency probe API to mark the start when the chain begins and ends
+ * 		  with the same probe.
+ * @param me
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t Probe_Start(Probe_t * const me);
+
+/**
+ * @brief Latency probe API to record the latency from Probe_Start.
+ * @param me
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, deadline missed
+ */
+os_Error_t Probe_Stop(Probe_t * const me);
+
+/**
+ * @brief Latency probe API to clear the histogram and the counters.
+ * @param me
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t Probe_Reset(Probe_t * const me);
+
+/**
+ * @brief Latency probe API to export the histogram: the magic, the number of
+ * 		  buckets, then count, min, max, misses and the buckets as unsigned
+ * 		  LEB128 varints.
+ * @param me
+ * @param buffer
+ * @param size size of buffer, PROBE_EXPORT_SIZE is always enough
+ * @param len bytes written
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, buffer too small
+ */
+os_Error_t Probe_Export(Probe_t * const me, uint8_t * buffer, size_t size, size_t * len);
+
+/**
+ * @brief Deadline miss hook, called in the context that recorded the
+ * 		  latency.
+ * @param me
+ * @param latency in us
+ */
+void __attribute__((weak)) probeDeadlineHook(Probe_t * const me, uint32_t latency);
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} doxygen end group definition */
+
+/* end of file ---------------------------------------------------------------*/
+
+#endif /* #ifndef _OS_PROBE_H_ */
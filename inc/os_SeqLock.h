@@ -0,0 +1,118 @@
+/*
+ * os_SeqLock.h
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+#ifndef _OS_SEQLOCK_H_
+#define _OS_SEQLOCK_H_
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Core.h"
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* macros --------------------------------------------------------------------*/
+
+/*
+ * A sequence lock protects data with a single writer and several readers
+ * without masking the interrupts. The sequence is odd while a write is in
+ * progress; the writer never waits and the readers copy the data again if the
+ * sequence changed during the copy. A reader must not preempt the writer (the
+ * writer is an ISR, the readers are tasks or lower priority ISRs), otherwise
+ * it would retry for ever.
+ */
+
+/* typedef -------------------------------------------------------------------*/
+
+/**
+ * @brief Sequence lock control structure.
+ */
+typedef struct {
+	volatile uint32_t sequence;	/**< Odd while a write is in progress */
+} SeqLock_t;
+
+/* external data declaration -------------------------------------------------*/
+
+/* external functions declaration --------------------------------------------*/
+
+/**
+ * @brief Sequence lock initialization.
+ * @param me
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t SeqLock_Init(SeqLock_t * const me);
+
+/**
+ * @brief Sequence lock API to start a write. Never waits.
+ * @param me
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t SeqLock_WriteBegin(SeqLock_t * const me);
+
+/**
+ * @brief Sequence lock API to end a write.
+ * @param me
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t SeqLock_WriteEnd(SeqLock_t * const me);
+
+/**
+ * @brief Sequence lock API to start a read. Waits while a write is in
+ * 		  progress.
+ * @param me
+ * @return sequence to pass to SeqLock_ReadRetry
+ */
+uint32_t SeqLock_ReadBegin(SeqLock_t * const me);
+
+/**
+ * @brief Sequence lock API to end a read.
+ * @param me
+ * @param sequence returned by SeqLock_ReadBegin
+ * @return true if the data was written during the read and it must be read
+ * 		   again
+ */
+bool SeqLock_ReadRetry(SeqLock_t * const me, uint32_t sequence);
+
+/**
+ * @brief Sequence lock API to write a whole object.
+ * @param me
+ * @param dst shared object
+ * @param src
+ * @param size
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t SeqLock_Write(SeqLock_t * const me, void * dst, const void * src, size_t size);
+
+/**
+ * @brief Sequence lock API to read a consistent copy of a whole object.
+ * @param me
+ * @param dst
+ * @param src shared object
+ * @param size
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t SeqLock_Read(SeqLock_t * const me, void * dst, const void * src, size_t size);
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} doxygen end group definition */
+
+/* end of file ---------------------------------------------------------------*/
+
+#endif /* #ifndef _OS_SEQLOCK_H_ */
@@ -0,0 +1,124 @@
+/*
+ * os_Stream.h
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+#ifndef _OS_STREAM_H_
+#define _OS_STREAM_H_
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Core.h"
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* macros --------------------------------------------------------------------*/
+
+/*
+ * A stream buffer is a byte ring in storage provided by the user, with a
+ * single writer (task or ISR) and a single reader (task). The writer and the
+ * reader do not share any index, so the data is moved without a critical
+ * section and the reader is notified directly by the writer. It is used as
+ * a byte stream (Stream_Write/Stream_Read) or as a buffer of messages with a
+ * length prefix (Stream_WriteMessage/Stream_ReadMessage), not both.
+ */
+
+#define STREAM_HEADER_SIZE	sizeof(uint16_t)	/**< Length prefix of a message */
+
+/* typedef -------------------------------------------------------------------*/
+
+/**
+ * @brief Stream buffer control structure.
+ */
+typedef struct {
+	uint8_t * buffer;			/**< Storage, provided by the user */
+	uint32_t size;				/**< Storage size in bytes, power of 2 */
+	volatile uint32_t head;		/**< Bytes read, only written by the reader */
+	volatile uint32_t tail;		/**< Bytes written, only written by the writer */
+	uint32_t trigger;			/**< Bytes needed to wake up the reader */
+	volatile uint32_t waiting;	/**< Bytes the blocked reader waits for, 0 if it is not blocked */
+	Semaphore_t ready;			/**< Given by the writer to wake up the reader */
+} Stream_t;
+
+/* external data declaration -------------------------------------------------*/
+
+/* external functions declaration --------------------------------------------*/
+
+/**
+ * @brief Stream buffer initialization.
+ * @param me
+ * @param buffer storage
+ * @param size storage size in bytes, power of 2
+ * @param trigger bytes needed to wake up the reader of a byte stream
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t Stream_Init(Stream_t * const me, uint8_t * buffer, size_t size, size_t trigger);
+
+/**
+ * @brief Stream buffer API to write bytes. Never blocks, can be called from
+ * 		  ISRs.
+ * @param me
+ * @param data
+ * @param len
+ * @param written number of bytes written, can be NULL
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, not all the bytes fit in the buffer
+ */
+os_Error_t Stream_Write(Stream_t * const me, const void * data, size_t len, size_t * written);
+
+/**
+ * @brief Stream buffer API to read bytes. The task blocks until the trigger
+ * 		  level, or len if it is lower, is reached.
+ * @param me
+ * @param data
+ * @param len max number of bytes to read
+ * @param received number of bytes read, can be NULL
+ * @param ticks 0 to return right away with the bytes available
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, no bytes received before the timeout
+ */
+os_Error_t Stream_Read(Stream_t * const me, void * data, size_t len, size_t * received, uint32_t ticks);
+
+/**
+ * @brief Stream buffer API to write a message. The message is written whole
+ * 		  or not at all. Never blocks, can be called from ISRs.
+ * @param me
+ * @param data
+ * @param len up to UINT16_MAX bytes
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, the message does not fit in the buffer
+ */
+os_Error_t Stream_WriteMessage(Stream_t * const me, const void * data, size_t len);
+
+/**
+ * @brief Stream buffer API to read a message.
+ * @param me
+ * @param data
+ * @param size size of data
+ * @param len message length. If data is too small, the message is kept and
+ * 		  len is the size needed
+ * @param ticks 0 to return right away if there is no message
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, no message received before the timeout or data is
+ * 		   	 too small
+ */
+os_Error_t Stream_ReadMessage(Stream_t * const me, void * data, size_t size, size_t * len, uint32_t ticks);
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} doxygen end group definition */
+
+/* end of file ---------------------------------------------------------------*/
+
+#endif /* #ifndef _OS_STREAM_H_ */
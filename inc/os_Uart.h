@@ -0,0 +1,112 @@
+/*
+ * os_Uart.h
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+#ifndef _OS_UART_H_
+#define _OS_UART_H_
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Core.h"
+#include "os_Dma.h"
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* macros --------------------------------------------------------------------*/
+
+#define UART_TX_SLOTS		4	/**< Number of transmission buffers */
+#define UART_TX_SLOT_SIZE	64	/**< Transmission buffer size in bytes */
+
+/* typedef -------------------------------------------------------------------*/
+
+/**
+ * @brief UART transmission buffer.
+ */
+typedef struct {
+	uint8_t data[UART_TX_SLOT_SIZE];	/**< Data to transmit */
+	size_t len;							/**< Number of bytes to transmit */
+} Uart_Slot_t;
+
+/**
+ * @brief UART control structure.
+ */
+typedef struct {
+	LPC_USART_T * uart;					/**< UART peripheral */
+	uint32_t peripheral;				/**< GPDMA peripheral connection for TX */
+	uint8_t channel;					/**< GPDMA channel */
+	Uart_Slot_t slots[UART_TX_SLOTS];	/**< Transmission buffers */
+	size_t head;						/**< Index of the buffer in transmission */
+	size_t tail;						/**< Index of the next free buffer */
+	size_t count;						/**< Number of buffers in use */
+	bool busy;							/**< DMA transfer in flight */
+	uint32_t errors;					/**< Number of transfers with error */
+	Semaphore_t done;					/**< Given each time a transfer ends */
+} Uart_t;
+
+/* external data declaration -------------------------------------------------*/
+
+/* external functions declaration --------------------------------------------*/
+
+/**
+ * @brief UART driver initialization. The UART must be already configured
+ * 		  (baud rate, pins), this function enables its DMA requests and
+ * 		  gets a GPDMA channel.
+ * @param me
+ * @param uart UART peripheral, e.g. LPC_USART2 for UART_USB
+ * @param peripheral GPDMA TX connection, e.g. GPDMA_CONN_UART2_Tx
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t Uart_Init(Uart_t * const me, LPC_USART_T * uart, uint32_t peripheral);
+
+/**
+ * @brief UART API to write data. The data is copied into the transmission
+ * 		  buffers and sent by the DMA, so the function returns as soon as
+ * 		  it is queued. If all the buffers are in use, the calling task
+ * 		  is blocked until one is free. Other tasks keep running while
+ * 		  the transfer is in flight.
+ * @param me
+ * @param data
+ * @param len
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ * @warning Only one task at a time can be blocked on the driver.
+ */
+os_Error_t Uart_Write(Uart_t * const me, const void * data, size_t len);
+
+/**
+ * @brief UART API to write a null terminated string.
+ * @param me
+ * @param str
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t Uart_WriteString(Uart_t * const me, const char * str);
+
+/**
+ * @brief UART API to block the calling task until all the queued data
+ * 		  was transmitted.
+ * @param me
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t Uart_Flush(Uart_t * const me);
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} doxygen end group definition */
+
+/* end of file ---------------------------------------------------------------*/
+
+#endif /* #ifndef _OS_UART_H_ */
@@ -0,0 +1,132 @@
+/*
+ * os_Work.h
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+#ifndef _OS_WORK_H_
+#define _OS_WORK_H_
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Core.h"
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* macros --------------------------------------------------------------------*/
+
+/*
+ * A work queue defers short jobs, a function and its argument, from ISRs and
+ * tasks to a pool of worker tasks that share the same priority. The jobs
+ * must not block for long, a blocked job holds its worker.
+ */
+
+#define WORK_JOBS_MAX		16	/**< Length of the jobs ring of a work queue */
+#define WORK_WORKERS_MAX	4	/**< Max number of worker tasks of a work queue */
+
+/* typedef -------------------------------------------------------------------*/
+
+/**
+ * @brief Work queue job function type.
+ */
+typedef void (* WorkQueue_Function_t)(void * arg);
+
+/**
+ * @brief Work queue job.
+ */
+typedef struct {
+	WorkQueue_Function_t function;	/**< Function to execute */
+	void * arg;						/**< Function argument */
+	uint32_t submitted;				/**< Submission timestamp in us */
+} WorkQueue_Job_t;
+
+/**
+ * @brief Work queue worker.
+ */
+typedef struct {
+	Semaphore_t wake;			/**< Given when a job is submitted to the idle worker */
+	struct WorkQueue_s * queue;	/**< Work queue served by the worker */
+	uint8_t id;					/**< Worker index in the work queue */
+} WorkQueue_Worker_t;
+
+/**
+ * @brief Work queue statistics.
+ */
+typedef struct {
+	uint32_t submitted;		/**< Jobs accepted */
+	uint32_t completed;		/**< Jobs executed */
+	uint32_t dropped;		/**< Jobs lost because the ring was full */
+	uint32_t backlog;		/**< Jobs waiting in the ring */
+	uint32_t backlogMax;	/**< Max jobs waiting in the ring */
+	uint32_t latencyMax;	/**< Max time in us from the submission to the execution */
+	uint32_t latencyAvg;	/**< Average time in us from the submission to the execution */
+} WorkQueue_Stats_t;
+
+/**
+ * @brief Work queue control structure.
+ */
+typedef struct WorkQueue_s {
+	WorkQueue_Job_t jobs[WORK_JOBS_MAX];				/**< Jobs ring */
+	uint8_t head;										/**< Next job to execute */
+	uint8_t count;										/**< Jobs in the ring */
+	uint8_t workersNum;									/**< Number of worker tasks */
+	uint8_t idleMask;									/**< Bitmap of the workers waiting for a job */
+	WorkQueue_Worker_t workers[WORK_WORKERS_MAX];		/**< Workers */
+	uint32_t submitted;									/**< Jobs accepted */
+	uint32_t completed;									/**< Jobs executed */
+	uint32_t dropped;									/**< Jobs lost because the ring was full */
+	uint32_t backlogMax;								/**< Max jobs waiting in the ring */
+	uint32_t latencyMax;								/**< Max latency in us */
+	uint64_t latencySum;								/**< Sum of the latencies in us */
+} WorkQueue_t;
+
+/* external data declaration -------------------------------------------------*/
+
+/* external functions declaration --------------------------------------------*/
+
+/**
+ * @brief Work queue initialization. Creates the worker tasks, must be called
+ * 		  before the scheduler starts or from a task.
+ * @param me
+ * @param workers number of worker tasks, up to WORK_WORKERS_MAX
+ * @param priority priority of the worker tasks
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t WorkQueue_Init(WorkQueue_t * const me, uint32_t workers, uint32_t priority);
+
+/**
+ * @brief Work queue API to submit a job. Can be called from tasks and ISRs.
+ * @param me
+ * @param function
+ * @param arg
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail, the jobs ring is full
+ */
+os_Error_t WorkQueue_Submit(WorkQueue_t * const me, WorkQueue_Function_t function, void * arg);
+
+/**
+ * @brief Work queue API to get the statistics.
+ * @param me
+ * @param stats
+ * @return - OS_OK: successful
+ * 		   - OS_FAIL: fail
+ */
+os_Error_t WorkQueue_GetStats(WorkQueue_t * const me, WorkQueue_Stats_t * stats);
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} doxygen end group definition */
+
+/* end of file ---------------------------------------------------------------*/
+
+#endif /* #ifndef _OS_WORK_H_ */
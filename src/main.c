@@ -13,6 +13,14 @@
 #include "board.h"
 #include "sapi.h"
 #include "os_Core.h"
+#include "os_Uart.h"
+#include "os_Log.h"
+#include "os_Probe.h"
+#include "os_SeqLock.h"
+
+#if !OS_USE_QUEUES || !OS_USE_IRQS || !OS_USE_LOG || !OS_USE_PROBES || !OS_USE_SEQLOCKS
+#error "The application needs OS_USE_QUEUES, OS_USE_IRQS, OS_USE_LOG, OS_USE_PROBES and OS_USE_SEQLOCKS"
+#endif
 
 /* macros --------------------------------------------------------------------*/
 
@@ -24,6 +32,9 @@
 
 #define MILISEC			1	/* 1 ms time */
 
+#define ISR_TO_PROCESS_BUDGET		1000	/* Deadline from the button edge to process() in us */
+#define PROCESS_TO_OUTPUT_BUDGET	2000	/* Deadline from process() to output() in us */
+
 /* typedef -------------------------------------------------------------------*/
 
 /* Structure to identify the button pressed */
@@ -32,10 +43,18 @@ typedef enum {
 	B2
 } id_e;
 
+typedef struct {
+	uint32_t rising;	/* Rising edge timestamp in us */
+	uint32_t falling;	/* Falling edge timestamp in us */
+} edges_t;
+
+/* The ISR times the edges of a press and publishes them to process() under
+ * the sequence lock, the queue only carries the id of the button */
 typedef struct {
 	id_e id;
-	uint32_t rising;
-	uint32_t falling;
+	edges_t edges;		/* Edges being timed by the ISR */
+	edges_t published;	/* Last edges published, read by process() */
+	SeqLock_t lock;		/* Protects published */
 } button_t;
 
 
@@ -45,6 +64,7 @@ typedef struct {
 	uint32_t time;
 	uint32_t rising;
 	uint32_t falling;
+	uint32_t timestamp;	/* Send timestamp in us */
 } led_t;
 
 /* data declaration ----------------------------------------------------------*/
@@ -53,10 +73,17 @@ typedef struct {
 Queue_t processQueue;
 Queue_t outputQueue;
 
+/* UART USB driver instance */
+Uart_t uartUsb;
+
 /* Button instances */
 button_t b1 = {0};
 button_t b2 = {0};
 
+/* Latency probes */
+Probe_t isrToProcess;
+Probe_t processToOutput;
+
 /* function declaration ------------------------------------------------------*/
 
 /* Initializations */
@@ -73,8 +100,6 @@ static void output(void * arg);
 /* ISR handlers */
 static void gpioISR(void * arg);
 
-/* Utils */
-static char * itoa(int value, char* result, int base);
 
 /* main ----------------------------------------------------------------------*/
 
@@ -85,13 +110,29 @@ int main() {
 	/* OS initialization */
     os_Init();
 
+    /* UART driver initialization */
+    if(Uart_Init(&uartUsb, LPC_USART2, GPDMA_CONN_UART2_Tx) != OS_OK) {
+    	errorHandler();
+    }
+
     /* Queues initialization */
-    Queue_Init(&processQueue, sizeof(button_t));
+    Queue_Init(&processQueue, sizeof(id_e));
     Queue_Init(&outputQueue, sizeof(led_t));
 
+#if OBJECT_STATS
+    os_SetObjectName(&processQueue.object, "processQueue");
+    os_SetObjectName(&outputQueue.object, "outputQueue");
+#endif
+
+    /* Latency probes initialization */
+    Probe_Init(&isrToProcess, "isrToProcess", ISR_TO_PROCESS_BUDGET);
+    Probe_Init(&processToOutput, "processToOutput", PROCESS_TO_OUTPUT_BUDGET);
+
     /* Initializacion button instances */
     b1.id = B1;
     b2.id = B2;
+    SeqLock_Init(&b1.lock);
+    SeqLock_Init(&b2.lock);
 
     /* Install IRQ services */
     os_InstallIRQ(PIN_INT0_IRQn, gpioISR, &b1);
@@ -148,6 +189,12 @@ static os_Error_t initTasks(void) {
 		return OS_FAIL;
 	}
 
+    err = os_CreateTask(Log_Task, "Log", IDLE_TASK_PRIORITY + 1, &uartUsb);
+
+	if(err != OS_OK) {
+		return OS_FAIL;
+	}
+
 	return err;
 }
 
@@ -158,39 +205,46 @@ static void errorHandler(void) {
 
 /* Tasks */
 static void process(void * arg) {
-	button_t button;
-	button_t buttons[2];
+	id_e id;
+	edges_t edges;
+	edges_t buttons[2] = {0};
 	led_t led;
 
 	int fallingTime = 0;
 	int risingTime = 0;
 
 	for(;;) {
-		/* Wait for data */
-		Queue_Receive(&processQueue, &button, MAX_TIME_DELAY);
+		/* Wait for an edge */
+		Queue_Receive(&processQueue, &id, MAX_TIME_DELAY);
 
-		/* Assign data to buttons array */
-		switch(button.id) {
+		/* Consistent copy of the edges, the ISR may publish the next ones
+		 * at any time */
+		switch(id) {
 			case B1:
-				buttons[0] = button;
+				SeqLock_Read(&b1.lock, &edges, &b1.published, sizeof(edges_t));
+				buttons[0] = edges;
 
 				break;
 
 			case B2:
-				buttons[1] = button;
+				SeqLock_Read(&b2.lock, &edges, &b2.published, sizeof(edges_t));
+				buttons[1] = edges;
 
 				break;
 		}
 
+		/* Latency from the edge that sent the button */
+		Probe_Record(&isrToProcess, edges.rising != 0 ? edges.rising : edges.falling);
+
 		/* If both button were pressed, then calculate the difference
 		 * between the falling edges and continue */
 		if(buttons[0].falling != 0 && buttons[1].falling != 0) {
-			fallingTime = buttons[0].falling - buttons[1].falling;
+			fallingTime = ((int32_t)(buttons[0].falling - buttons[1].falling)) / 1000;
 
 			/* If both button were released, then calculate the difference
 			 * between the rising edges and continue */
 			if(buttons[0].rising != 0 && buttons[1].rising != 0) {
-				risingTime = buttons[0].rising - buttons[1].rising;
+				risingTime = ((int32_t)(buttons[0].rising - buttons[1].rising)) / 1000;
 
 				/* Determine the case according the value of the falling
 				 * and rising edges */
@@ -220,6 +274,7 @@ static void process(void * arg) {
 				}
 
 				/* Send to queue and reset buttons values */
+				led.timestamp = Probe_Now();
 				Queue_Send(&outputQueue, &led);
 
 				buttons[0].falling = 0;
@@ -244,9 +299,7 @@ static void output(void * arg) {
 	led_t led = {0};
 	led_t leds[4] = {0};
 
-	char timeValue[] = "XXXXX";
-	char ledColor[] = "XXXXXXXX";
-	char message[] = "\t Tiempo entre flancos descendentes: XXXXX ms \n\r";
+	const char * ledColor = NULL;
 
 	for(;;) {
 		/* Try to get data and continue */
@@ -255,25 +308,27 @@ static void output(void * arg) {
 		/* If the data was received, then store the led data and
 		 * define the led color string */
 		if(led.led != 0) {
+			Probe_Record(&processToOutput, led.timestamp);
+
 			switch(led.led) {
 				case LEDB:
 					leds[0] = led;
-					strcpy(ledColor, "Azul");
+					ledColor = "Azul";
 
 					break;
 				case LED1:
 					leds[1] = led;
-					strcpy(ledColor, "Amarillo");
+					ledColor = "Amarillo";
 
 					break;
 				case LED2:
 					leds[2] = led;
-					strcpy(ledColor, "Rojo");
+					ledColor = "Rojo";
 
 					break;
 				case LED3:
 					leds[3] = led;
-					strcpy(ledColor, "Verde");
+					ledColor = "Verde";
 
 					break;
 
@@ -281,26 +336,11 @@ static void output(void * arg) {
 					break;
 			}
 
-			/* Write message without sprintf() */
-			strcpy(message, "Led ");
-			strcat(message, ledColor);
-			strcat(message, " encendido \n\r");
-			uartWriteString(UART_USB, message);
-			strcpy(message,"\t Tiempo encendido: ");
-			itoa(led.time, timeValue, 10);
-			strcat(message, timeValue);
-			strcat(message, " ms \n\r");
-			uartWriteString(UART_USB, message);
-			strcpy(message,"\t Tiempo entre flancos descendentes: ");
-			itoa(led.falling, timeValue, 10);
-			strcat(message, timeValue);
-			strcat(message, " ms \n\r");
-			uartWriteString(UART_USB, message);
-			strcpy(message,"\t Tiempo entre flancos ascendentes: ");
-			itoa(led.rising, timeValue, 10);
-			strcat(message, timeValue);
-			strcat(message, " ms \n\r");
-			uartWriteString(UART_USB, message);
+			/* Log the message, it is formatted on the host */
+			LOG("Led %s encendido\n\r", ledColor);
+			LOG("\t Tiempo encendido: %u ms \n\r", led.time);
+			LOG("\t Tiempo entre flancos descendentes: %u ms \n\r", led.falling);
+			LOG("\t Tiempo entre flancos ascendentes: %u ms \n\r", led.rising);
 		}
 
 		/* Turn on and turn off the LEDs according the led's structures */
@@ -326,51 +366,32 @@ static void output(void * arg) {
 
 static void gpioISR(void * arg) {
 	button_t * button = (button_t *)arg;
+	uint64_t timestamp;
 
-	/* Get ticks count when falling and rising flanks occur */
-	if(button->falling == 0) {
-		os_GetTickCounter(&button->falling);
+	/* Get the time in us when falling and rising flanks occur. Only the
+	 * lower 32 bits are stored, the differences between them are wrap-safe */
+	os_GetTimeUs(&timestamp);
+
+	if(button->edges.falling == 0) {
+		button->edges.falling = (uint32_t)timestamp;
 	}
 	else {
-		os_GetTickCounter(&button->rising);
+		button->edges.rising = (uint32_t)timestamp;
 	}
 
-	/* Sed to queue and clear interrupt flag */
-	Queue_Send(&processQueue, button);
+	/* Publish the edges, then send the id to queue and clear interrupt
+	 * flag */
+	SeqLock_Write(&button->lock, &button->published, &button->edges, sizeof(edges_t));
+	Queue_Send(&processQueue, &button->id);
 	Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, PININTCH(button->id));
 
-	/* Reset the falling and rising counters after send to queue */
-	if(button->falling != 0 && button->rising != 0) {
-		button->falling = 0;
-		button->rising = 0;
+	/* Reset the falling and rising counters after publishing them */
+	if(button->edges.falling != 0 && button->edges.rising != 0) {
+		button->edges.falling = 0;
+		button->edges.rising = 0;
 	}
 
 	os_Yield();
 }
 
-/* Utils */
-static char * itoa(int value, char* result, int base) {
-   // check that the base if valid
-   if (base < 2 || base > 36) { *result = '\0'; return result; }
-
-   char* ptr = result, *ptr1 = result, tmp_char;
-   int tmp_value;
-
-   do {
-      tmp_value = value;
-      value /= base;
-      *ptr++ = "zyxwvutsrqponmlkjihgfedcba9876543210123456789abcdefghijklmnopqrstuvwxyz" [35 + (tmp_value - value * base)];
-   } while ( value );
-
-   // Apply negative sign
-   if (tmp_value < 0) *ptr++ = '-';
-   *ptr-- = '\0';
-   while(ptr1 < ptr) {
-      tmp_char = *ptr;
-      *ptr--= *ptr1;
-      *ptr1++ = tmp_char;
-   }
-   return result;
-}
-
 /* end of file ---------------------------------------------------------------*/
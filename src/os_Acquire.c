@@ -0,0 +1,232 @@
+/*
+ * os_Acquire.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Acquire.h"
+
+#if OS_USE_ACQUIRE
+
+/* macros --------------------------------------------------------------------*/
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+/* external data declaration -------------------------------------------------*/
+
+/* internal functions declaration --------------------------------------------*/
+
+static void startTransfer(Acquire_t * const me);
+static void transferDone(void * arg, bool ok);
+static uint8_t nextBuffer(Acquire_t * const me, uint8_t buffer);
+static void linkBuffer(Acquire_t * const me, uint8_t buffer, uint8_t next);
+static uint8_t linkedBuffer(Acquire_t * const me, uint8_t buffer);
+
+/* external functions definition ---------------------------------------------*/
+
+os_Error_t Acquire_Init(Acquire_t * const me, uint32_t peripheral, uint32_t * storage, size_t count, size_t samples) {
+	os_Error_t err = OS_OK;
+
+	/* Return with error if the parameters are not valid */
+	if(storage == NULL || count < ACQUIRE_BUFFERS_MIN || count > ACQUIRE_BUFFERS_MAX
+			|| samples == 0 || samples > ACQUIRE_SAMPLES_MAX) {
+		return OS_FAIL;
+	}
+
+	me->peripheral = peripheral;
+	me->storage = storage;
+	me->samples = samples;
+	me->count = count;
+	me->fill = 0;
+	me->queued = 0;
+	me->head = 0;
+	me->ready = 0;
+	me->held = 0;
+	me->running = false;
+	me->overruns = 0;
+	me->errors = 0;
+	Semaphore_Init(&me->full);
+
+	/* One descriptor per buffer, each one linked to itself until the
+	 * chain is decided */
+	for(uint8_t i = 0; i < count; i++) {
+		if(Chip_GPDMA_InitDescriptor(LPC_GPDMA, &me->descriptors[i], me->peripheral,
+				(uint32_t)(me->storage + i * me->samples), me->samples,
+				GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA, &me->descriptors[i]) == ERROR) {
+			return OS_FAIL;
+		}
+	}
+
+	err = Dma_Init();
+
+	if(err == OS_OK) {
+		err = Dma_Open(me->peripheral, transferDone, me, &me->channel);
+	}
+
+	return err;
+}
+
+os_Error_t Acquire_Start(Acquire_t * const me) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	if(me->running == false) {
+		me->running = true;
+		startTransfer(me);
+	}
+
+	os_ExitCritical();
+
+	return err;
+}
+
+os_Error_t Acquire_Stop(Acquire_t * const me) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	me->running = false;
+	Chip_GPDMA_Stop(LPC_GPDMA, me->channel);
+
+	os_ExitCritical();
+
+	return err;
+}
+
+os_Error_t Acquire_Get(Acquire_t * const me, uint32_t ** buffer, uint32_t ticks) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	/* A give of a buffer already taken is discarded before waiting, a new
+	 * buffer ready after this point is not lost */
+	if(me->ready == 0) {
+		Semaphore_TryTake(&me->full);
+	}
+
+	os_ExitCritical();
+
+	if(me->ready == 0 && ticks > 0) {
+		Semaphore_TakeTimeout(&me->full, ticks);
+	}
+
+	os_EnterCritical();
+
+	if(me->ready > 0) {
+		* buffer = me->storage + ((me->head + me->held) % me->count) * me->samples;
+		me->ready--;
+		me->held++;
+	}
+	else {
+		* buffer = NULL;
+		err = OS_FAIL;
+	}
+
+	os_ExitCritical();
+
+	return err;
+}
+
+os_Error_t Acquire_Release(Acquire_t * const me) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	if(me->held > 0) {
+		me->head = (me->head + 1) % me->count;
+		me->held--;
+	}
+	else {
+		err = OS_FAIL;
+	}
+
+	os_ExitCritical();
+
+	return err;
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static void startTransfer(Acquire_t * const me) {
+	/* The chain starts at the current buffer, the buffer after it and the
+	 * link after that one are decided before the DMA loads them */
+	me->queued = me->fill;
+	me->queued = nextBuffer(me, me->fill);
+	linkBuffer(me, me->fill, me->queued);
+	linkBuffer(me, me->queued, nextBuffer(me, me->queued));
+
+	if(Chip_GPDMA_SGTransfer(LPC_GPDMA, me->channel, &me->descriptors[me->fill],
+			GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA) == ERROR) {
+		me->errors++;
+		me->running = false;
+	}
+}
+
+static void transferDone(void * arg, bool ok) {
+	Acquire_t * me = (Acquire_t *)arg;
+	uint8_t done = me->fill;
+
+	if(me->running == false) {
+		return;
+	}
+
+	/* The channel stops on an error, it starts again with the same buffer */
+	if(ok == false) {
+		me->errors++;
+		startTransfer(me);
+
+		return;
+	}
+
+	/* The DMA already moved to the queued buffer and loaded its link */
+	me->fill = me->queued;
+	me->queued = linkedBuffer(me, me->fill);
+
+	/* The filled buffer is handed to the task. Its link is reset, so a
+	 * link is never left pointing to a buffer of the task. A buffer linked
+	 * to itself was filled again */
+	if(me->fill != done) {
+		me->ready++;
+		linkBuffer(me, done, done);
+
+		Semaphore_Give(&me->full);
+	}
+	else {
+		me->overruns++;
+	}
+
+	/* Decide what follows the queued buffer before the DMA loads it */
+	linkBuffer(me, me->queued, nextBuffer(me, me->queued));
+}
+
+static uint8_t nextBuffer(Acquire_t * const me, uint8_t buffer) {
+	uint8_t next = (buffer + 1) % me->count;
+	uint8_t taken = (next + me->count - me->head) % me->count;
+
+	/* The buffers ready and held follow the head in order. The next
+	 * buffer is free if it is not one of them nor owned by the DMA,
+	 * otherwise the buffer is filled again */
+	if(taken < me->ready + me->held || next == me->fill || next == me->queued) {
+		next = buffer;
+	}
+
+	return next;
+}
+
+static void linkBuffer(Acquire_t * const me, uint8_t buffer, uint8_t next) {
+	me->descriptors[buffer].lli = (uint32_t)&me->descriptors[next];
+}
+
+static uint8_t linkedBuffer(Acquire_t * const me, uint8_t buffer) {
+	return (me->descriptors[buffer].lli - (uint32_t)me->descriptors) / sizeof(DMA_TransferDescriptor_t);
+}
+
+#endif /* #if OS_USE_ACQUIRE */
+
+/* end of file ---------------------------------------------------------------*/
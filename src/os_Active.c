@@ -0,0 +1,129 @@
+/*
+ * os_Active.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Active.h"
+
+#if OS_USE_ACTIVE
+
+/* macros --------------------------------------------------------------------*/
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+/* external data declaration -------------------------------------------------*/
+
+/* IRQs of each level */
+static const LPC43XX_IRQn_Type levelIRQ[ACTIVE_LEVELS] = ACTIVE_IRQS;
+
+/* Active objects of each level */
+static Active_t * levels[ACTIVE_LEVELS];
+
+/* internal functions declaration --------------------------------------------*/
+
+static void dispatcher(void * arg);
+
+/* external functions definition ---------------------------------------------*/
+
+os_Error_t Active_Start(Active_t * const me, Active_Handler_t handler, uint32_t priority, Active_Event_t * queue, size_t len) {
+	os_Error_t err = OS_OK;
+
+	/* Return with error if the parameters are not valid */
+	if(handler == NULL || queue == NULL || len == 0 || len > UINT8_MAX || priority >= ACTIVE_LEVELS) {
+		return OS_FAIL;
+	}
+
+	me->handler = handler;
+	me->queue = queue;
+	me->len = len;
+	me->head = 0;
+	me->count = 0;
+	me->priority = priority;
+	me->dropped = 0;
+
+	os_EnterCritical();
+
+	/* The first active object of a level installs its dispatcher */
+	if(levels[priority] == NULL) {
+		NVIC_SetPriority(levelIRQ[priority], ACTIVE_NVIC_PRIORITY - priority);
+		err = os_InstallIRQ(levelIRQ[priority], dispatcher, &levels[priority]);
+	}
+
+	if(err == OS_OK) {
+		me->next = levels[priority];
+		levels[priority] = me;
+	}
+
+	os_ExitCritical();
+
+	return err;
+}
+
+os_Error_t Active_Post(Active_t * const me, uint32_t signal, uint32_t param) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	if(me->count < me->len) {
+		Active_Event_t * event = &me->queue[(me->head + me->count) % me->len];
+
+		event->signal = signal;
+		event->param = param;
+		me->count++;
+
+		/* The dispatcher runs as soon as no higher priority code is running */
+		NVIC_SetPendingIRQ(levelIRQ[me->priority]);
+	}
+	else {
+		me->dropped++;
+		err = OS_FAIL;
+	}
+
+	os_ExitCritical();
+
+	return err;
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static void dispatcher(void * arg) {
+	Active_t ** level = (Active_t **)arg;
+	bool pending;
+
+	/* Dispatch one event of each active object of the level in turns until
+	 * all the queues are empty. Posts to higher levels preempt this loop,
+	 * posts to lower levels are tail-chained when it ends */
+	do {
+		pending = false;
+
+		for(Active_t * ao = * level; ao != NULL; ao = ao->next) {
+			Active_Event_t event;
+
+			os_EnterCritical();
+
+			if(ao->count == 0) {
+				os_ExitCritical();
+				continue;
+			}
+
+			event = ao->queue[ao->head];
+			ao->head = (ao->head + 1) % ao->len;
+			ao->count--;
+
+			os_ExitCritical();
+
+			ao->handler(ao, &event);
+			pending = true;
+		}
+	} while(pending == true);
+}
+
+#endif /* #if OS_USE_ACTIVE */
+
+/* end of file ---------------------------------------------------------------*/
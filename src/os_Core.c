@@ -7,10 +7,40 @@
 
 /* inclusions ----------------------------------------------------------------*/
 
+#include <stddef.h>
+
 #include "os_Core.h"
 
 /* macros --------------------------------------------------------------------*/
 
+#define TASK_IDLE	(&os.tasksArray[IDLE_TASK_ID])	/**< Idle task hot data */
+
+/* Layout of the kernel data used by PendSV_Handler.S */
+_Static_assert(offsetof(os_t, taskCurrent) == 0, "PendSV_Handler.S expects taskCurrent at offset 0");
+_Static_assert(offsetof(os_t, taskNext) == sizeof(os_Task_t *), "PendSV_Handler.S expects taskNext at offset 4");
+_Static_assert(offsetof(os_t, contextSwitches) == 2 * sizeof(os_Task_t *), "PendSV_Handler.S expects contextSwitches at offset 8");
+_Static_assert(offsetof(os_t, postMortem) == 3 * sizeof(os_Task_t *), "PendSV_Handler.S expects postMortem at offset 12");
+_Static_assert(offsetof(os_Task_t, sp) == 0, "PendSV_Handler.S expects sp at offset 0");
+_Static_assert(offsetof(os_Task_t, state) == 8, "PendSV_Handler.S expects state at offset 8");
+_Static_assert(offsetof(os_Task_t, id) == 10, "PendSV_Handler.S expects id at offset 10");
+_Static_assert(offsetof(os_Task_t, fpu) == 15, "PendSV_Handler.S expects fpu at offset 15");
+_Static_assert(offsetof(os_PostMortem_t, switches) == 24, "PendSV_Handler.S expects switches at offset 24");
+_Static_assert(offsetof(os_PostMortem_t, tasks) == 24 + 4 * POSTMORTEM_SWITCHES, "PendSV_Handler.S expects tasks right after switches");
+_Static_assert(sizeof(os_PostMortemSwitch_t) == 4 && sizeof(os_PostMortemTask_t) == 8, "PendSV_Handler.S expects 4 and 8 bytes records");
+
+/* Objects statistics, compiled out when disabled */
+#if OBJECT_STATS
+#define STATS_COUNT(me, field, n)	((me)->object.stats.field += (n))
+#define STATS_PEAK(me, value)		objectPeak(&(me)->object, (value))
+#define STATS_BLOCKED(me, start)	objectBlocked(&(me)->object, (start))
+#define STATS_REGISTER(me, type)	objectRegister(&(me)->object, (type))
+#else
+#define STATS_COUNT(me, field, n)
+#define STATS_PEAK(me, value)
+#define STATS_BLOCKED(me, start)	((void)(start))
+#define STATS_REGISTER(me, type)
+#endif
+
 /* typedef -------------------------------------------------------------------*/
 
 /* internal data declaration -------------------------------------------------*/
@@ -20,17 +50,83 @@
 /* OS parameters instance */
 static os_t os;
 
+/* Global name of the OS parameters for PendSV_Handler.S */
+extern os_t os_Kernel __attribute__((alias("os")));
+
+/* Tasks stacks */
+static uint32_t tasksStack[TASKS_MAX][STACK_SIZE_WORDS] __attribute__((section(STACKS_SECTION), aligned(8)));
+
+#if OS_USE_IRQS
 /* ISR handlers array */
 static ISR_t isrHandler[IRQ_NUM];
+#endif
+
+#if OS_USE_IRQ_RATE_LIMIT
+/* Rate limited IRQs */
+static os_IRQCoalesce_t coalesceTable[IRQ_COALESCE_MAX];
+#endif
+
+#if OBJECT_STATS
+/* Registry of the kernel objects, it can be read by a debugger */
+static os_Object_t * objects;
+#endif
+
+#if OS_USE_POSTMORTEM
+/* Post-mortem snapshots, they are not cleared by the startup code. Each
+ * run writes one and keeps the other one, left by the previous run */
+static os_PostMortem_t postMortems[2] __attribute__((section(POSTMORTEM_SECTION)));
+static os_PostMortem_t * postMortemPrevious;
+#endif
 
 /* internal functions declaration --------------------------------------------*/
 
 static void scheduler(void);
+static void reschedule(void);
 static void setPendSV(void);
-static int  comparePriorities(const void * n1vp, const void * n2vp);
-static void sortTaks(os_Task_t * array, size_t n);
+static os_Error_t createTask(void * task, const char * name, uint32_t priority, void * arg, uint32_t * stack, size_t words, bool fpu, void * caller);
+static void initTask(uint32_t id, void * entryPoint, const char * name, uint32_t priority, void * arg, uint32_t * stack, size_t words, bool fpu);
+static void reloadSlice(os_Task_t * task);
+static void readySet(os_Task_t * task);
+static void readyClear(os_Task_t * task);
+static uint32_t readyFind(uint32_t priority, uint32_t start);
+static void timerInsert(os_Task_t * task);
+static void timerRemove(os_Task_t * task);
+static uint32_t taskAlloc(void);
+#if OS_USE_TASK_CONTROL
+static void taskDetach(os_Task_t * task);
+#endif
+static void taskBlock(os_Task_t * task, uint32_t ticks, os_Task_t ** waiter);
+static void taskUnblock(os_Task_t * task);
+static bool waiterRelease(os_Task_t ** waiter);
+static void readTimebase(uint64_t * ticks, uint32_t * elapsed);
+#if OS_USE_QUEUES
 static Queue_State_e queueState(Queue_t * queue);
+static size_t queueCount(Queue_t * queue);
+static void queueCopyIn(Queue_t * queue, const uint8_t * data, size_t n);
+static void queueCopyOut(Queue_t * queue, uint8_t * data, size_t n);
+#endif
+#if OS_USE_QUEUE_SETS
+static void notifySet(struct QueueSet_s * set);
+static void * readySetMember(QueueSet_t * set);
+#endif
+#if OS_USE_IRQ_RATE_LIMIT
+static bool irqCoalesce(os_IRQCoalesce_t * coalesce, void * arg);
+static void irqWindows(uint32_t now);
+#endif
+#if OS_USE_IRQS
 static void IRQHandler(LPC43XX_IRQn_Type IRQn);
+#endif
+#if OBJECT_STATS
+static void objectRegister(os_Object_t * object, os_ObjectType_e type);
+static void objectPeak(os_Object_t * object, uint32_t value);
+static void objectBlocked(os_Object_t * object, uint32_t start);
+#endif
+static void taskReturn(void);
+static void errorRecord(os_ErrorCode_e code, void * caller);
+#if OS_USE_POSTMORTEM
+static void postMortemInit(void);
+static void postMortemTask(uint32_t id);
+#endif
 
 /* external functions definition ---------------------------------------------*/
 
@@ -40,74 +136,225 @@ os_Error_t os_Init(void) {
 	/* Set PendSV priority as the lowest */
 	NVIC_SetPriority(PendSV_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
 
+	/* Automatic and lazy FPU state preservation: the hardware reserves the
+	 * FPU registers in the frame of a context that used the FPU and only
+	 * saves them if the exception uses the FPU too */
+	FPU->FPCCR |= FPU_FPCCR_ASPEN_Msk | FPU_FPCCR_LSPEN_Msk;
+
 	/* Initialize os parameters */
 	os.state = FROM_RESET_STATE;
 	os.taskCurrent = NULL;
 	os.taskNext = NULL;
+	os.error = OS_ERROR_NONE;
+	os.postMortem = NULL;
+
+#if OS_USE_POSTMORTEM
+	/* Keep the snapshot of the previous run and start a new one */
+	postMortemInit();
+#endif
+
+	/* Placeholder of main() for the first switch, it is never scheduled.
+	 * main() could have used the FPU */
+	memset(&os.resetTask, 0, sizeof(os.resetTask));
+	os.resetTask.state = DELETED_STATE;
+	os.resetTask.id = TASK_NONE;
+	os.resetTask.fpu = true;
 	os.tasksNum = 0;
+	os.timerHead = TASK_NONE;
+	os.readyPriorities = 0;
+	memset(os.readyMask, 0, sizeof(os.readyMask));
+	memset(os.lastRun, 0, sizeof(os.lastRun));
+
+	/* All the task slots are free */
+	for(uint32_t i = 0; i < TASKS_MAX; i++) {
+		os.tasksArray[i].state = DELETED_STATE;
+	}
+
+#if OS_USE_IRQ_RATE_LIMIT
+	/* No IRQ is rate limited */
+	for(uint32_t i = 0; i < IRQ_NUM; i++) {
+		isrHandler[i].coalesce = IRQ_COALESCE_NONE;
+	}
+#endif
+
+	/* Idle task initialization. It is not in the ready bitmaps, the
+	 * scheduler selects it when there is not other task ready */
+	initTask(IDLE_TASK_ID, idleTask, "Idle", IDLE_TASK_PRIORITY, NULL, os.taskIdleStack, STACK_SIZE_WORDS, false);
+	TASK_IDLE->timeSlice = 0;
 
-	/* Idle task initialization */
-	os.taskIdle.stack = os.taskIdleStack;
-	os.taskIdle.stack[STACK_SIZE_WORDS - XPSR_REG_POS] = INIT_XPSR;
-	os.taskIdle.stack[STACK_SIZE_WORDS - PC_REG_POS] = (uint32_t)idleTask;
-	os.taskIdle.stack[STACK_SIZE_WORDS - LR_REG_POS] = (uint32_t)returnHook;
-	os.taskIdle.stack[STACK_SIZE_WORDS - LR_PREV_REG_POS] = EXC_RETURN;
-	os.taskIdle.sp = (uint32_t)(os.taskIdle.stack + STACK_SIZE_WORDS - FULL_STACKING_SIZE);
-	os.taskIdle.entryPoint = idleTask;
-	os.taskIdle.priority = IDLE_TASK_PRIORITY;
-	os.taskIdle.id = 0xFF;
-	os.taskIdle.state = READY_STATE;
-
-	/* Initialize tick counter */
+	/* Initialize tick and context switches counters */
 	os.tickCounter = 0;
+	os.contextSwitches = 0;
 
 	return err;
 }
 
-/* todo: implement argument in the task */
 os_Error_t os_CreateTask(void * task, const char * name, uint32_t priority, void * arg) {
+	/* The reserved priority is only given by os_CreateTaskReserved() */
+	if(priority == PRIORITY_RESERVED) {
+		return OS_FAIL;
+	}
+
+	return createTask(task, name, priority, arg, NULL, STACK_SIZE_WORDS, false, __builtin_return_address(0));
+}
+
+os_Error_t os_CreateTaskStatic(void * task, const char * name, uint32_t priority, void * arg, uint32_t * stack, size_t words) {
+	/* The stack must be 8 bytes aligned (AAPCS) and fit the context */
+	if(stack == NULL || ((uint32_t)stack & 0x7) != 0 || words < TASK_STACK_MIN || priority == PRIORITY_RESERVED) {
+		return OS_FAIL;
+	}
+
+	return createTask(task, name, priority, arg, stack, words & ~1UL, false, __builtin_return_address(0));
+}
+
+os_Error_t os_CreateTaskFpu(void * task, const char * name, uint32_t priority, void * arg, uint32_t * stack, size_t words) {
+	/* The stack of the slot is used when none is provided */
+	if(stack == NULL) {
+		words = STACK_SIZE_WORDS;
+	}
+	else if(((uint32_t)stack & 0x7) != 0) {
+		return OS_FAIL;
+	}
+
+	/* A task using the FPU saves 34 words more in each switch */
+	if(words < FPU_TASK_STACK_MIN || priority == PRIORITY_RESERVED) {
+		return OS_FAIL;
+	}
+
+	return createTask(task, name, priority, arg, stack, words & ~1UL, true, __builtin_return_address(0));
+}
+
+#if OS_USE_CYCLIC
+os_Error_t os_CreateTaskReserved(void * task, const char * name, void * arg) {
+	/* A single task has the reserved priority, no other task is ready at
+	 * that priority to delay it */
+	for(uint32_t id = 0; id < TASKS_MAX; id++) {
+		if(os.tasksArray[id].state != DELETED_STATE && os.tasksArray[id].priority == PRIORITY_RESERVED) {
+			return OS_FAIL;
+		}
+	}
+
+	return createTask(task, name, PRIORITY_RESERVED, arg, NULL, STACK_SIZE_WORDS, false, __builtin_return_address(0));
+}
+#endif
+
+#if OS_USE_TASK_CONTROL
+os_Error_t os_DeleteTask(uint32_t id) {
 	os_Error_t err = OS_OK;
+	os_Task_t * task;
+
+	if(id >= TASKS_MAX) {
+		return OS_FAIL;
+	}
 
-	/* If there are space available, then store and init the task */
-	if(os.tasksNum < TASKS_MAX) {
-		os.tasksArray[os.tasksNum].stack = os.tasksStack[os.tasksNum];
+	task = &os.tasksArray[id];
 
-		os.tasksArray[os.tasksNum].stack[STACK_SIZE_WORDS - XPSR_REG_POS] = INIT_XPSR;
-		os.tasksArray[os.tasksNum].stack[STACK_SIZE_WORDS - PC_REG_POS] = (uint32_t)task;
-		os.tasksArray[os.tasksNum].stack[STACK_SIZE_WORDS - LR_REG_POS] = (uint32_t)returnHook;
-		os.tasksArray[os.tasksNum].stack[STACK_SIZE_WORDS - LR_PREV_REG_POS] = EXC_RETURN;
+	os_EnterCritical();
 
-		os.tasksArray[os.tasksNum].sp = (uint32_t)(os.tasksArray[os.tasksNum].stack + STACK_SIZE_WORDS - FULL_STACKING_SIZE);
+	if(task->state == DELETED_STATE) {
+		err = OS_FAIL;
+	}
+	else {
+		/* Take the task out of the bitmaps, the timeouts list and the
+		 * object it is blocked on, then free the slot */
+		taskDetach(task);
+		task->state = DELETED_STATE;
+		os.tasksNum--;
+
+		/* A task that deletes itself does not return from here. Its slot
+		 * is not reused until the context switch leaves its stack. A task
+		 * already chosen by a pending switch is replaced before it runs */
+		if(task == os.taskCurrent || task == os.taskNext) {
+			reschedule();
+		}
+	}
 
-		os.tasksArray[os.tasksNum].entryPoint = task;
-		os.tasksArray[os.tasksNum].priority = priority;
-		strncpy(os.tasksArray[os.tasksNum].name, name, strlen(name));
-		os.tasksArray[os.tasksNum].id = os.tasksNum;
-		os.tasksArray[os.tasksNum].state = READY_STATE;
+	os_ExitCritical();
 
-		os.tasksNum++;
+	return err;
+}
+
+os_Error_t os_SuspendTask(uint32_t id) {
+	os_Error_t err = OS_OK;
+	os_Task_t * task;
+
+	if(id >= TASKS_MAX) {
+		return OS_FAIL;
+	}
+
+	task = &os.tasksArray[id];
+
+	os_EnterCritical();
+
+	if(task->state == DELETED_STATE || task->state == SUSPENDED_STATE) {
+		err = OS_FAIL;
 	}
 	else {
+		/* A suspended task is not in the bitmaps nor in the timeouts
+		 * list, so it costs nothing to the scheduler and the SysTick */
+		taskDetach(task);
+		task->state = SUSPENDED_STATE;
+
+		if(task == os.taskCurrent || task == os.taskNext) {
+			reschedule();
+		}
+	}
+
+	os_ExitCritical();
+
+	return err;
+}
+
+os_Error_t os_ResumeTask(uint32_t id) {
+	os_Error_t err = OS_OK;
+	os_Task_t * task;
+
+	if(id >= TASKS_MAX) {
+		return OS_FAIL;
+	}
+
+	task = &os.tasksArray[id];
+
+	os_EnterCritical();
+
+	if(task->state != SUSPENDED_STATE) {
 		err = OS_FAIL;
-		errorHook(NULL);
 	}
+	else {
+		task->state = READY_STATE;
+		readySet(task);
+		reschedule();
+	}
+
+	os_ExitCritical();
 
 	return err;
 }
+#endif
 
-os_Error_t os_DeleteTask(uint32_t id) {
+os_Error_t os_GetTaskId(uint32_t * id) {
 	os_Error_t err = OS_OK;
 
+	if(os.taskCurrent == NULL || os.taskCurrent == TASK_IDLE) {
+		return OS_FAIL;
+	}
+
+	* id = os.taskCurrent->id;
+
 	return err;
 }
 
 os_Error_t os_StartScheduler(void) {
 	os_Error_t err = OS_OK;
 
-	sortTaks(os.tasksArray, os.tasksNum);
+	/* Tasks run in thread mode with the PSP and the exceptions use the
+	 * MSP, so the ISRs and the active objects share the stack of main()
+	 * instead of growing every task stack. The first context switch saves
+	 * the context of main() in a scratch area that is never restored */
+	__set_PSP((uint32_t)(os.resetFrame + FPU_TASK_STACK_MIN));
 
 	SystemCoreClockUpdate();
-	SysTick_Config(SystemCoreClock / SYSTICK_TIME);
+	SysTick_Config(SystemCoreClock / (1000000 / SYSTICK_TIME));
 
 	return err;
 }
@@ -115,12 +362,15 @@ os_Error_t os_StartScheduler(void) {
 os_Error_t os_Yield(void) {
 	os_Error_t err = OS_OK;
 
-	scheduler();
-
-	if(os.doScheduling == true) {
-		setPendSV();
+	/* A task that yields on its own gives up the rest of its time slice,
+	 * so the next task with the same priority can run. A yield from an
+	 * ISR must not steal the slice of the interrupted task */
+	if(os.state == NORMAL_RUN_STATE && os.taskCurrent->state == RUNNING_STATE) {
+		os.taskCurrent->ticksSlice = 0;
 	}
 
+	reschedule();
+
 	return err;
 }
 
@@ -136,14 +386,19 @@ os_Error_t os_EnterCritical(void) {
 os_Error_t os_ExitCritical(void) {
 	os_Error_t err = OS_OK;
 
-	if(os.criticalCounter <= 0) {
-		os.criticalCounter = 0;
+	/* Enable the interrupts only when the outermost critical section ends */
+	if(os.criticalCounter > 0) {
+		os.criticalCounter--;
+	}
+
+	if(os.criticalCounter == 0) {
 		__enable_irq();
 	}
 
 	return err;
 }
 
+#if OS_USE_IRQS
 os_Error_t os_InstallIRQ(LPC43XX_IRQn_Type irq, void * isr, void * arg) {
 	os_Error_t err = OS_OK;
 
@@ -181,310 +436,963 @@ os_Error_t os_UninstallIRQ(LPC43XX_IRQn_Type irq) {
 
 	return err;
 }
+#endif
 
-os_Error_t os_TaskDelay(uint32_t ticks) {
+#if OS_USE_IRQ_RATE_LIMIT
+os_Error_t os_SetIRQRateLimit(LPC43XX_IRQn_Type irq, uint32_t ticks, void * ack) {
 	os_Error_t err = OS_OK;
+	uint8_t index = isrHandler[irq].coalesce;
 
-	if(ticks > 0) {
-		os.taskCurrent->state = BLOCKED_STATE;
-		os.taskCurrent->ticksBlocked = ticks;
+	os_EnterCritical();
 
-		os_Yield();
+	/* Disable the rate limiting, a masked IRQ is enabled again */
+	if(ticks == 0) {
+		if(index != IRQ_COALESCE_NONE) {
+			if(coalesceTable[index].open == true && coalesceTable[index].ack == NULL) {
+				NVIC_EnableIRQ(irq);
+			}
+
+			coalesceTable[index].window = 0;
+			isrHandler[irq].coalesce = IRQ_COALESCE_NONE;
+		}
+	}
+	else {
+		/* Take a free entry of the table */
+		if(index == IRQ_COALESCE_NONE) {
+			for(uint32_t i = 0; i < IRQ_COALESCE_MAX; i++) {
+				if(coalesceTable[i].window == 0) {
+					index = i;
+					break;
+				}
+			}
+		}
+
+		if(index != IRQ_COALESCE_NONE) {
+			memset(&coalesceTable[index], 0, sizeof(os_IRQCoalesce_t));
+			coalesceTable[index].ack = ack;
+			coalesceTable[index].window = ticks;
+			coalesceTable[index].irq = irq;
+			isrHandler[irq].coalesce = index;
+		}
+		else {
+			err = OS_FAIL;
+		}
 	}
 
+	os_ExitCritical();
+
 	return err;
 }
 
-os_Error_t os_GetTickCounter(uint32_t * ticks) {
+os_Error_t os_GetIRQEvents(LPC43XX_IRQn_Type irq, os_IRQEvents_t * events) {
 	os_Error_t err = OS_OK;
+	uint8_t index = isrHandler[irq].coalesce;
 
-	* ticks = os.tickCounter;
+	if(index == IRQ_COALESCE_NONE) {
+		return OS_FAIL;
+	}
+
+	* events = coalesceTable[index].events;
 
 	return err;
 }
 
-os_Error_t Semaphore_Init(Semaphore_t * const me) {
+os_Error_t os_GetIRQStats(LPC43XX_IRQn_Type irq, os_IRQStats_t * stats) {
 	os_Error_t err = OS_OK;
+	uint8_t index = isrHandler[irq].coalesce;
 
-	me->task = NULL;
-	me->isGiven = false;
+	if(index == IRQ_COALESCE_NONE) {
+		return OS_FAIL;
+	}
+
+	os_EnterCritical();
+	* stats = coalesceTable[index].stats;
+	os_ExitCritical();
 
 	return err;
 }
+#endif
 
-os_Error_t Semaphore_Take(Semaphore_t * const me) {
+os_Error_t os_TaskDelay(uint32_t ticks) {
 	os_Error_t err = OS_OK;
 
-	me->task = os.taskCurrent;
-
-
-	if(me->isGiven == false) {
-		me->task->state = BLOCKED_STATE;
-		me->task->ticksBlocked = MAX_TIME_DELAY;
+	if(ticks > 0) {
+		/* Block and pend the switch in one critical section, as the objects
+		 * do, so the SysTick can not wake the task up in between */
+		os_EnterCritical();
 
+		taskBlock(os.taskCurrent, ticks, NULL);
 		os_Yield();
-	}
 
-	if(me->isGiven == true) {
-		me->isGiven = false;
+		os_ExitCritical();
 	}
 
 	return err;
 }
 
-os_Error_t Semaphore_Give(Semaphore_t * const me) {
+os_Error_t os_TaskDelayUntil(uint32_t * wake, uint32_t ticks) {
 	os_Error_t err = OS_OK;
+	uint32_t now;
 
-	me->isGiven = true;
+	os_EnterCritical();
 
-	/* If the task associated to semaphore is a valid pointer, then the
-	 * ticks blocked is reset and the Systick handler will change its state
-	 * to READY_STATE */
-	if(me->task != NULL) {
-		me->task->ticksBlocked = 0;
+	now = (uint32_t)os.tickCounter;
+	* wake += ticks;
+
+	/* The task is woken up by the SysTick at the wake tick, not after a
+	 * delay from now, so the period does not drift. If the wake tick
+	 * already passed, then the period was overrun */
+	if(TICKS_AFTER(* wake, now)) {
+		taskBlock(os.taskCurrent, * wake - now, NULL);
+		os_Yield();
+	}
+	else {
+		err = OS_FAIL;
 	}
 
+	os_ExitCritical();
+
 	return err;
 }
 
-os_Error_t Queue_Init(Queue_t * const me, size_t size) {
+os_Error_t os_GetTickCounter(uint32_t * ticks) {
 	os_Error_t err = OS_OK;
 
-	/* Define the length (number of elements) of th queue */
-	me->size = size;
-	me->len = QUEUE_SIZE_BYTES / me->size;
+	* ticks = (uint32_t)os.tickCounter;
 
-	/* Indexes initialization. If head equato to tail, then
-	 * the queue is empty */
-	me->head = 0;
-	me->tail = 0;
+	return err;
+}
 
-	/* Initialize the task associated to queue in NULL */
-	me->task = NULL;
+os_Error_t os_GetTickCounter64(uint64_t * ticks) {
+	os_Error_t err = OS_OK;
+	uint32_t elapsed;
+
+	readTimebase(ticks, &elapsed);
 
 	return err;
 }
 
-os_Error_t Queue_Send(Queue_t * const me, void * data) {
+os_Error_t os_GetCycles(uint64_t * cycles) {
 	os_Error_t err = OS_OK;
+	uint64_t ticks;
+	uint32_t elapsed;
 
-	/* If the task associated to queue is a valid pointer, then the ticks
-	 * blocked is reset and the Systick handler will change its state to
-	 * READY_STATE */
-	if(me->task != NULL) {
-		me->task->ticksBlocked = 0;
-	}
+	readTimebase(&ticks, &elapsed);
 
-	/* If queue is full return with error */
-	if(queueState(me) == QUEUE_FULL_STATE) {
-		err = OS_FAIL;
-	}
-	/* If queue is not full, then write data */
-	else {
-		if(memcpy(me->data + me->tail, data, me->size) != NULL) {
-			me->tail += me->size;
-		}
-		else {
-			err = OS_FAIL;
-		}
-	}
+	* cycles = ticks * (SysTick->LOAD + 1) + elapsed;
 
 	return err;
 }
 
-os_Error_t Queue_Receive(Queue_t * const me, void * data, uint32_t ticks) {
+os_Error_t os_GetTimeUs(uint64_t * us) {
 	os_Error_t err = OS_OK;
+	uint64_t ticks;
+	uint32_t elapsed;
 
-	me->task = os.taskCurrent;
+	readTimebase(&ticks, &elapsed);
 
-	/* If the queue is empty, then block the task */
-	if(queueState(me) == QUEUE_EMPTY_STATE) {
-		if(ticks > 0) {
-			me->task->state = BLOCKED_STATE;
-			me->task->ticksBlocked = ticks;
-			os_Yield();
-		}
-	}
+	* us = ticks * SYSTICK_TIME + (uint64_t)elapsed * SYSTICK_TIME / (SysTick->LOAD + 1);
 
-	if(queueState(me) != QUEUE_EMPTY_STATE) {
-		/* Read the first element of the queue */
-		if(memcpy(data, me->data + me->head, me->size) != NULL) {
-			me->head += me->size;
+	return err;
+}
 
-			if(me->head == me->tail) {
-				me->head = 0;
-				me->tail = 0;
-			}
-//			me->tail -= me->size;
-		}
-		else {
-			err = OS_FAIL;
-		}
+os_Error_t os_SetTimeSlice(uint32_t ticks) {
+	os_Error_t err = OS_OK;
+
+	/* Only a running task can change its own time slice */
+	if(os.taskCurrent == NULL || os.taskCurrent == TASK_IDLE || ticks > UINT8_MAX) {
+		return OS_FAIL;
 	}
 
+	os.taskCurrent->timeSlice = ticks;
+	reloadSlice(os.taskCurrent);
+
 	return err;
 }
 
-void SysTick_Handler(void) {
-	/* Increment tick counter */
-	os.tickCounter++;
+os_Error_t os_GetContextSwitches(uint32_t * switches) {
+	os_Error_t err = OS_OK;
 
-	/* Decrement ticks blocked in task with BLOCKED_STATE state*/
-	for(size_t i = 0; i < os.tasksNum; i++) {
-		if(os.tasksArray[i].state == BLOCKED_STATE) {
-			if(os.tasksArray[i].ticksBlocked > 0) {
-				os.tasksArray[i].ticksBlocked--;
-			}
+	* switches = os.contextSwitches;
 
-			if(os.tasksArray[i].ticksBlocked == 0) {
-				os.tasksArray[i].state = READY_STATE;
-			}
-		}
-	}
+	return err;
+}
 
-	/*
-	 * Dentro del SysTick handler se llama al scheduler. Separar el scheduler de
-	 * getContextoSiguiente da libertad para cambiar la politica de scheduling en cualquier
-	 * estadio de desarrollo del OS. Recordar que scheduler() debe ser lo mas corto posible
-	 */
-	scheduler();
+os_Error_t os_GetError(uint32_t * error) {
+	os_Error_t err = OS_OK;
 
-	if(os.doScheduling == true) {
-		setPendSV();
-	}
+	* error = os.error;
 
-	tickHook();
+	return err;
 }
 
-/* Hooks */
-void __attribute__((weak)) returnHook(void) {
-	for(;;);
-}
+#if OS_USE_POSTMORTEM
+os_Error_t os_GetPostMortem(os_PostMortem_t * snapshot) {
+	os_Error_t err = OS_OK;
 
-void __attribute__((weak)) tickHook(void) {
-	__asm volatile( "nop" );
-}
+	if(postMortemPrevious == NULL) {
+		return OS_FAIL;
+	}
 
-void __attribute__((weak)) errorHook(void *caller) {
-	/*
-	 * Revisar el contenido de control_OS.error para obtener informacion. Utilizar os_getError()
-	 */
-	for(;;);
-}
+	memcpy(snapshot, postMortemPrevious, sizeof(os_PostMortem_t));
 
-void __attribute__((weak)) idleTask(void)  {
-	for(;;) {
-		__WFI();
-	}
+	return err;
 }
 
-uint32_t getNextContext(uint32_t spCurrent) {
-	uint32_t spNext;
+os_Error_t os_UpdatePostMortem(void) {
+	os_Error_t err = OS_OK;
+	uint32_t id = os.postMortemTask;
 
-	/*
-	 * En la primera llamada a getContextoSiguiente, se designa que la primer tarea a ejecutar sea
-	 * la tarea actual, la cual es la primer tarea inicializada y cuyo puntero de estructura fuese
-	 * cargado por la funcion scheduler (observar flujo de programa). Como todas las tareas se crean
-	 * en estado READY, directamente se cambia a estado RUNNING y se actualiza la variable de estado
-	 * de sistema
-	 */
-	if(os.state == FROM_RESET_STATE) {
-		spNext = os.taskCurrent->sp;
+	/* One task per call, its stack is scanned with the interrupts enabled */
+	os.postMortemTask = (id < IDLE_TASK_ID) ? id + 1 : 0;
+	postMortemTask(id);
 
-		os.taskCurrent->state = RUNNING_STATE;
-		os.state = NORMAL_RUN_STATE;
-	}
+	return err;
+}
+#endif
 
-	/*
-	 * En el caso que no sea la primera vez que se ejecuta esta funcion, se hace un cambio de contexto
-	 * de manera habitual. Se guarda el MSP (sp_actual) en la variable correspondiente de la estructura
-	 * de la tarea corriendo actualmente. Como a este punto no hay mas estados implementados (solamente
-	 * READY y RUNNING) se pasa la tarea actual a estado READY.
-	 * Se carga en la variable sp_siguiente el stack pointer de la tarea siguiente, que fue definida
-	 * por el scheduler. Se actualiza la misma a estado RUNNING y se retorna al handler de PendSV
-	 */
-	else {
-		os.taskCurrent->sp = spCurrent;
+#if OBJECT_STATS
+os_Error_t os_SetObjectName(os_Object_t * object, const char * name) {
+	os_Error_t err = OS_OK;
 
-		if(os.taskCurrent->state == RUNNING_STATE) {
-			os.taskCurrent->state = READY_STATE;
-		}
+	object->name = name;
 
-		spNext = os.taskNext->sp;
+	return err;
+}
 
-		os.taskCurrent = os.taskNext;
-		os.taskCurrent->state = RUNNING_STATE;
-	}
+os_Object_t * os_GetNextObject(os_Object_t * object) {
+	return object == NULL ? objects : object->next;
+}
 
-	os.doScheduling = false;
+os_Error_t os_GetObjectStats(os_Object_t * object, os_ObjectStats_t * stats) {
+	os_Error_t err = OS_OK;
 
-	return spNext;
-}
+	/* The counters are copied at once, the system keeps running */
+	os_EnterCritical();
+	* stats = object->stats;
+	os_ExitCritical();
 
-/* internal functions definition ---------------------------------------------*/
+	return err;
+}
 
-static void scheduler(void) {
-	/* When the OS state is FROM_RESET_STATE set the first task in
-	 * taskArray as taskCurrent */
-	if(os.state == FROM_RESET_STATE) {
-		os.taskCurrent = &os.taskIdle;
-		os.taskNext = os.taskCurrent;
-		os.doScheduling = true;
-	}
-	/* If is not the first time the OS run, then select the next task
-	 * from the tasks array */
-	else {
-		uint8_t index = 0;
-		uint8_t count = os.tasksNum;
-
-		/* While the count of tasks is not 0, find the next task according
-		 * the position in the tasks array, state and the priority */
-		while(count > 0) {
-			if(index <= os.taskCurrent->id) {
-				if(os.tasksArray[index].state == READY_STATE) {
-					if(os.tasksArray[index].priority > os.taskCurrent->priority) {
-						os.taskNext = &os.tasksArray[index];
-						os.doScheduling = true;
-						break;
-					}
-					else {
-						if(os.taskCurrent->priority > os.tasksArray[os.taskCurrent->id + 1].priority) {
-							os.taskNext = &os.tasksArray[index];
-							os.doScheduling = true;
-							break;
-						}
-					}
-				}
-			}
-			else {
-				if(os.tasksArray[index].state == READY_STATE) {
-					if(os.tasksArray[index].priority == os.taskCurrent->priority) {
-						os.taskNext = &os.tasksArray[index];
-						os.doScheduling = true;
-						break;
-					}
-					else if(os.taskCurrent->state == BLOCKED_STATE) {
-						os.taskNext = &os.tasksArray[index];
-						os.doScheduling = true;
-						break;
-					}
-				}
-			}
+os_Error_t os_RemoveObject(os_Object_t * object) {
+	os_Error_t err = OS_FAIL;
 
-			index++;
-			count--;
-		}
+	os_EnterCritical();
 
-		/* If any task in the tasks array is in READY_STATE state, then the next task is the idle task */
-		if(count == 0) {
-			os.taskNext = &os.taskIdle;
-			os.doScheduling = true;
+	for(os_Object_t ** link = &objects; * link != NULL; link = &(* link)->next) {
+		if(* link == object) {
+			* link = object->next;
+			err = OS_OK;
+			break;
 		}
 	}
+
+	os_ExitCritical();
+
+	return err;
 }
+#endif
 
-static void setPendSV(void) {
-	/**
+#if OS_USE_SEMAPHORES
+os_Error_t Semaphore_Init(Semaphore_t * const me) {
+	os_Error_t err = OS_OK;
+
+	me->task = NULL;
+	me->isGiven = false;
+	me->set = NULL;
+
+	STATS_REGISTER(me, OBJECT_SEMAPHORE);
+
+	return err;
+}
+
+os_Error_t Semaphore_Take(Semaphore_t * const me) {
+	return Semaphore_TakeTimeout(me, MAX_TIME_DELAY);
+}
+
+os_Error_t Semaphore_TakeTimeout(Semaphore_t * const me, uint32_t ticks) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	/* The check and the blocking are atomic, so a give from an ISR can not
+	 * be lost in between */
+	if(me->isGiven == false && ticks > 0) {
+		uint32_t start = (uint32_t)os.tickCounter;
+
+		taskBlock(os.taskCurrent, ticks, &me->task);
+
+		os_Yield();
+		os_ExitCritical();
+		os_EnterCritical();
+
+		waiterRelease(&me->task);
+		STATS_BLOCKED(me, start);
+	}
+
+	if(me->isGiven == true) {
+		me->isGiven = false;
+		STATS_COUNT(me, receives, 1);
+	}
+	/* Not given before the timeout */
+	else {
+		err = OS_FAIL;
+		STATS_COUNT(me, receiveFails, 1);
+	}
+
+	os_ExitCritical();
+
+	return err;
+}
+
+os_Error_t Semaphore_TryTake(Semaphore_t * const me) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	if(me->isGiven == true) {
+		me->isGiven = false;
+		STATS_COUNT(me, receives, 1);
+	}
+	else {
+		err = OS_FAIL;
+		STATS_COUNT(me, receiveFails, 1);
+	}
+
+	os_ExitCritical();
+
+	return err;
+}
+
+os_Error_t Semaphore_Give(Semaphore_t * const me) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	me->isGiven = true;
+	STATS_COUNT(me, sends, 1);
+	STATS_PEAK(me, 1);
+
+	/* If a task is blocked on the semaphore, then it is moved to
+	 * READY_STATE and scheduled right away */
+	if(me->task != NULL) {
+		taskUnblock(me->task);
+		reschedule();
+	}
+
+#if OS_USE_QUEUE_SETS
+	if(me->set != NULL) {
+		notifySet(me->set);
+	}
+#endif
+
+	os_ExitCritical();
+
+	return err;
+}
+#endif
+
+#if OS_USE_QUEUES
+os_Error_t Queue_Init(Queue_t * const me, size_t size) {
+	os_Error_t err = OS_OK;
+
+	/* Return with error if not even one element fits in the storage */
+	if(size == 0 || size > QUEUE_SIZE_BYTES) {
+		return OS_FAIL;
+	}
+
+	/* Define the length (number of elements) of th queue */
+	me->size = size;
+	me->len = QUEUE_SIZE_BYTES / me->size;
+
+	/* Indexes initialization. The storage is a ring, the count tells an
+	 * empty queue from a full one when head is equal to tail */
+	me->head = 0;
+	me->tail = 0;
+	me->count = 0;
+
+	/* Initialize the task and the set associated to queue in NULL */
+	me->task = NULL;
+	me->set = NULL;
+	me->threshold = 1;
+
+	STATS_REGISTER(me, OBJECT_QUEUE);
+
+	return err;
+}
+
+os_Error_t Queue_Send(Queue_t * const me, void * data) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	/* If queue is full return with error */
+	if(queueState(me) == QUEUE_FULL_STATE) {
+		err = OS_FAIL;
+		STATS_COUNT(me, sendFails, 1);
+	}
+	/* If queue is not full, then write data */
+	else {
+		queueCopyIn(me, data, 1);
+		STATS_COUNT(me, sends, 1);
+		STATS_PEAK(me, queueCount(me));
+
+		/* If a task is blocked on the queue and there are enough elements
+		 * for it, then it is moved to READY_STATE and scheduled right away */
+		if(me->task != NULL && queueCount(me) >= me->threshold) {
+			taskUnblock(me->task);
+			reschedule();
+		}
+
+#if OS_USE_QUEUE_SETS
+		if(me->set != NULL) {
+			notifySet(me->set);
+		}
+#endif
+	}
+
+	os_ExitCritical();
+
+	return err;
+}
+
+os_Error_t Queue_SendMany(Queue_t * const me, const void * data, size_t count, size_t * sent) {
+	os_Error_t err = OS_OK;
+	size_t n;
+
+	os_EnterCritical();
+
+	/* All the free space of the ring takes the elements, in at most two
+	 * copies */
+	n = me->len - queueCount(me);
+
+	if(n > count) {
+		n = count;
+	}
+
+	if(n > 0) {
+		queueCopyIn(me, data, n);
+		STATS_COUNT(me, sends, n);
+		STATS_PEAK(me, queueCount(me));
+
+		/* Only one wakeup and one scheduling for the whole batch */
+		if(me->task != NULL && queueCount(me) >= me->threshold) {
+			taskUnblock(me->task);
+			reschedule();
+		}
+
+#if OS_USE_QUEUE_SETS
+		if(me->set != NULL) {
+			notifySet(me->set);
+		}
+#endif
+	}
+
+	if(n < count) {
+		STATS_COUNT(me, sendFails, 1);
+	}
+
+	os_ExitCritical();
+
+	if(sent != NULL) {
+		* sent = n;
+	}
+
+	/* Not all the elements fit in the queue */
+	if(n < count) {
+		err = OS_FAIL;
+	}
+
+	return err;
+}
+
+os_Error_t Queue_Receive(Queue_t * const me, void * data, uint32_t ticks) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	/* If the queue is empty, then block the task. The check and the
+	 * blocking are atomic, so a send from an ISR can not be lost */
+	if(queueState(me) == QUEUE_EMPTY_STATE) {
+		if(ticks > 0) {
+			uint32_t start = (uint32_t)os.tickCounter;
+
+			me->threshold = 1;
+			taskBlock(os.taskCurrent, ticks, &me->task);
+
+			os_Yield();
+			os_ExitCritical();
+			os_EnterCritical();
+
+			waiterRelease(&me->task);
+			STATS_BLOCKED(me, start);
+		}
+	}
+
+	if(queueState(me) != QUEUE_EMPTY_STATE) {
+		/* Read the first element of the queue */
+		queueCopyOut(me, data, 1);
+		STATS_COUNT(me, receives, 1);
+	}
+	/* No data received before the timeout */
+	else {
+		err = OS_FAIL;
+		STATS_COUNT(me, receiveFails, 1);
+	}
+
+	os_ExitCritical();
+
+	return err;
+}
+
+os_Error_t Queue_ReceiveMany(Queue_t * const me, void * data, size_t count, size_t min, size_t * received, uint32_t ticks) {
+	os_Error_t err = OS_OK;
+	size_t n;
+
+	if(min == 0) {
+		min = 1;
+	}
+
+	/* Return with error if min elements can never be received: the ring
+	 * holds len elements wherever its head is */
+	if(min > count || min > me->len) {
+		return OS_FAIL;
+	}
+
+	os_EnterCritical();
+
+	n = queueCount(me);
+
+	/* If there are not enough elements, then block the task. The senders
+	 * wake it up only when min elements are available, not on every send */
+	if(n < min && ticks > 0) {
+		uint32_t start = (uint32_t)os.tickCounter;
+
+		me->threshold = min;
+		taskBlock(os.taskCurrent, ticks, &me->task);
+
+		os_Yield();
+		os_ExitCritical();
+		os_EnterCritical();
+
+		/* The threshold belongs to the waiter too */
+		if(waiterRelease(&me->task) == true) {
+			me->threshold = 1;
+		}
+
+		n = queueCount(me);
+		STATS_BLOCKED(me, start);
+	}
+
+	if(n > count) {
+		n = count;
+	}
+
+	/* Read the elements in at most two copies, even if they are less than
+	 * min because of the timeout */
+	if(n > 0) {
+		queueCopyOut(me, data, n);
+		STATS_COUNT(me, receives, n);
+	}
+
+	if(n < min) {
+		STATS_COUNT(me, receiveFails, 1);
+	}
+
+	os_ExitCritical();
+
+	if(received != NULL) {
+		* received = n;
+	}
+
+	/* Less than min elements received before the timeout */
+	if(n < min) {
+		err = OS_FAIL;
+	}
+
+	return err;
+}
+#endif
+
+#if OS_USE_PRIORITY_QUEUES
+os_Error_t PriorityQueue_Init(PriorityQueue_t * const me, size_t size) {
+	os_Error_t err = OS_OK;
+
+	/* Return with error if the size is not valid */
+	if(size == 0 || size > QUEUE_SIZE_BYTES) {
+		return OS_FAIL;
+	}
+
+	me->size = size;
+	me->len = QUEUE_SIZE_BYTES / me->size;
+
+	/* All the slots are in the free list and the priority lists are
+	 * empty */
+	for(size_t i = 0; i < me->len; i++) {
+		me->next[i] = i + 1;
+	}
+
+	me->next[me->len - 1] = QUEUE_SLOT_NONE;
+	me->free = 0;
+	me->priorities = 0;
+	memset(me->head, QUEUE_SLOT_NONE, sizeof(me->head));
+	memset(me->tail, QUEUE_SLOT_NONE, sizeof(me->tail));
+
+	me->task = NULL;
+
+	STATS_REGISTER(me, OBJECT_PRIORITY_QUEUE);
+
+	return err;
+}
+
+os_Error_t PriorityQueue_Send(PriorityQueue_t * const me, void * data, uint32_t priority) {
+	os_Error_t err = OS_OK;
+	uint8_t slot;
+
+	if(priority >= QUEUE_PRIORITIES) {
+		return OS_FAIL;
+	}
+
+	os_EnterCritical();
+
+	/* If queue is full return with error */
+	if(me->free == QUEUE_SLOT_NONE) {
+		err = OS_FAIL;
+		STATS_COUNT(me, sendFails, 1);
+	}
+	/* If queue is not full, then take a free slot and append it to the
+	 * list of its priority, so the order is FIFO within a priority */
+	else {
+		slot = me->free;
+		me->free = me->next[slot];
+
+		memcpy(me->data + slot * me->size, data, me->size);
+		me->next[slot] = QUEUE_SLOT_NONE;
+
+		if(me->tail[priority] == QUEUE_SLOT_NONE) {
+			me->head[priority] = slot;
+		}
+		else {
+			me->next[me->tail[priority]] = slot;
+		}
+
+		me->tail[priority] = slot;
+		me->priorities |= 1UL << priority;
+		STATS_COUNT(me, sends, 1);
+		STATS_PEAK(me, me->object.stats.sends - me->object.stats.receives);
+
+		/* If a task is blocked on the queue, then it is moved to
+		 * READY_STATE and scheduled right away */
+		if(me->task != NULL) {
+			taskUnblock(me->task);
+			reschedule();
+		}
+	}
+
+	os_ExitCritical();
+
+	return err;
+}
+
+os_Error_t PriorityQueue_Receive(PriorityQueue_t * const me, void * data, uint32_t ticks) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	/* If the queue is empty, then block the task */
+	if(me->priorities == 0 && ticks > 0) {
+		uint32_t start = (uint32_t)os.tickCounter;
+
+		taskBlock(os.taskCurrent, ticks, &me->task);
+
+		os_Yield();
+		os_ExitCritical();
+		os_EnterCritical();
+
+		waiterRelease(&me->task);
+		STATS_BLOCKED(me, start);
+	}
+
+	if(me->priorities != 0) {
+		/* Take the head of the highest priority list */
+		uint32_t priority = 31 - __CLZ(me->priorities);
+		uint8_t slot = me->head[priority];
+
+		memcpy(data, me->data + slot * me->size, me->size);
+
+		me->head[priority] = me->next[slot];
+
+		if(me->head[priority] == QUEUE_SLOT_NONE) {
+			me->tail[priority] = QUEUE_SLOT_NONE;
+			me->priorities &= ~(1UL << priority);
+		}
+
+		/* Give the slot back */
+		me->next[slot] = me->free;
+		me->free = slot;
+		STATS_COUNT(me, receives, 1);
+	}
+	/* No data received before the timeout */
+	else {
+		err = OS_FAIL;
+		STATS_COUNT(me, receiveFails, 1);
+	}
+
+	os_ExitCritical();
+
+	return err;
+}
+#endif
+
+#if OS_USE_QUEUE_SETS
+os_Error_t QueueSet_Init(QueueSet_t * const me) {
+	os_Error_t err = OS_OK;
+
+	me->len = 0;
+	me->last = 0;
+	me->task = NULL;
+
+	return err;
+}
+
+os_Error_t QueueSet_AddQueue(QueueSet_t * const me, Queue_t * const queue) {
+	os_Error_t err = OS_OK;
+
+	/* Return with error if the set is full or the queue has a set */
+	if(me->len >= QUEUE_SET_SIZE || queue->set != NULL) {
+		return OS_FAIL;
+	}
+
+	me->members[me->len].type = QUEUE_SET_QUEUE;
+	me->members[me->len].handle = queue;
+	me->len++;
+
+	queue->set = me;
+
+	return err;
+}
+
+os_Error_t QueueSet_AddSemaphore(QueueSet_t * const me, Semaphore_t * const semaphore) {
+	os_Error_t err = OS_OK;
+
+	/* Return with error if the set is full or the semaphore has a set */
+	if(me->len >= QUEUE_SET_SIZE || semaphore->set != NULL) {
+		return OS_FAIL;
+	}
+
+	me->members[me->len].type = QUEUE_SET_SEMAPHORE;
+	me->members[me->len].handle = semaphore;
+	me->len++;
+
+	semaphore->set = me;
+
+	return err;
+}
+
+os_Error_t QueueSet_Remove(QueueSet_t * const me, void * member) {
+	os_Error_t err = OS_FAIL;
+
+	for(size_t i = 0; i < me->len; i++) {
+		if(me->members[i].handle == member) {
+			if(me->members[i].type == QUEUE_SET_QUEUE) {
+				((Queue_t *)member)->set = NULL;
+			}
+			else {
+				((Semaphore_t *)member)->set = NULL;
+			}
+
+			/* Keep the members array packed */
+			me->len--;
+			me->members[i] = me->members[me->len];
+			me->last = 0;
+
+			err = OS_OK;
+			break;
+		}
+	}
+
+	return err;
+}
+
+os_Error_t QueueSet_Select(QueueSet_t * const me, void ** member, uint32_t ticks) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	* member = readySetMember(me);
+
+	/* If no member is ready, then block the task on the whole set */
+	if(* member == NULL && ticks > 0) {
+		taskBlock(os.taskCurrent, ticks, &me->task);
+
+		os_Yield();
+		os_ExitCritical();
+		os_EnterCritical();
+
+		waiterRelease(&me->task);
+		* member = readySetMember(me);
+	}
+
+	os_ExitCritical();
+
+	if(* member == NULL) {
+		err = OS_FAIL;
+	}
+
+	return err;
+}
+#endif
+
+void SysTick_Handler(void) {
+	uint32_t now;
+
+	os_EnterCritical();
+
+	/* Increment tick counter */
+	os.tickCounter++;
+	now = (uint32_t)os.tickCounter;
+
+	/* Wake up the tasks whose timeout expired. The timeouts list is sorted,
+	 * so only its head is checked and the cost does not depend on the
+	 * number of tasks */
+	while(os.timerHead != TASK_NONE && !TICKS_AFTER(os.tasksArray[os.timerHead].wakeTick, now)) {
+		taskUnblock(&os.tasksArray[os.timerHead]);
+	}
+
+#if OS_USE_IRQ_RATE_LIMIT
+	/* Deliver the events merged by the rate limited IRQs */
+	irqWindows(now);
+#endif
+
+#if OS_USE_POSTMORTEM
+	/* Only the tick, the tasks are refreshed by the idle task */
+	os.postMortem->tick = now;
+#endif
+
+	/* Consume the time slice of the running task. Tasks without slicing
+	 * keep the CPU until they block, yield or a higher priority task is
+	 * ready */
+	if(os.taskCurrent != NULL && os.taskCurrent->timeSlice > 0 && os.taskCurrent->ticksSlice > 0) {
+		os.taskCurrent->ticksSlice--;
+	}
+
+	/*
+	 * Dentro del SysTick handler se llama al scheduler. El scheduler decide la tarea siguiente y
+	 * PendSV solo intercambia los contextos, lo que da libertad para cambiar la politica de
+	 * scheduling en cualquier estadio de desarrollo del OS. Recordar que scheduler() debe ser lo
+	 * mas corto posible
+	 */
+	scheduler();
+
+	if(os.doScheduling == true) {
+		setPendSV();
+	}
+
+	os_ExitCritical();
+
+	tickHook();
+}
+
+/* Hooks */
+void __attribute__((weak)) returnHook(void) {
+	for(;;);
+}
+
+void __attribute__((weak)) tickHook(void) {
+	__asm volatile( "nop" );
+}
+
+void __attribute__((weak)) errorHook(void *caller) {
+	/*
+	 * Revisar el contenido de control_OS.error para obtener informacion. Utilizar os_getError()
+	 */
+	for(;;);
+}
+
+void __attribute__((weak)) idleTask(void)  {
+	for(;;) {
+#if OS_USE_POSTMORTEM
+		os_UpdatePostMortem();
+#endif
+		__WFI();
+	}
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static void scheduler(void) {
+	os_Task_t * current;
+	os_Task_t * next = TASK_IDLE;
+
+	/* The first switch saves the context of main() in a placeholder task */
+	if(os.state == FROM_RESET_STATE) {
+		os.taskCurrent = &os.resetTask;
+		os.taskNext = &os.resetTask;
+		os.state = NORMAL_RUN_STATE;
+	}
+
+	/* Task that runs once the switch pended, if any, is done */
+	current = os.taskNext;
+
+	/* Select the next task from the ready bitmaps. The cost does not
+	 * depend on the number of tasks. If no task is ready, then the next
+	 * task is the idle task */
+	if(os.readyPriorities != 0) {
+		uint32_t priority = 31 - __CLZ(os.readyPriorities);
+		uint32_t start = os.lastRun[priority];
+
+		/* The current task keeps running while its time slice is not
+		 * used up, otherwise the search starts right after it so the
+		 * tasks with the same priority take turns */
+		if(current != TASK_IDLE && current->state == RUNNING_STATE && current->priority == priority) {
+			start = current->id;
+
+			if(current->ticksSlice == 0) {
+				start++;
+			}
+		}
+
+		next = &os.tasksArray[readyFind(priority, start)];
+		os.lastRun[priority] = next->id;
+
+		/* The current task is the only one with its priority */
+		if(next == current && current->ticksSlice == 0) {
+			reloadSlice(current);
+		}
+	}
+
+	/* The switch is completed here, so PendSV only saves the context of
+	 * taskCurrent and restores the one of taskNext */
+	if(next != current) {
+		if(current->state == RUNNING_STATE) {
+			current->state = READY_STATE;
+		}
+
+		next->state = RUNNING_STATE;
+		reloadSlice(next);
+		os.taskNext = next;
+	}
+
+	/* A switch decided by a previous call can be undone before PendSV
+	 * runs, then PendSV returns right away */
+	os.doScheduling = (os.taskNext != os.taskCurrent);
+}
+
+static void reschedule(void) {
+	os_EnterCritical();
+
+	scheduler();
+
+	if(os.doScheduling == true) {
+		setPendSV();
+	}
+
+	os_ExitCritical();
+}
+
+static void setPendSV(void) {
+	/**
 	 * Se setea el bit correspondiente a la excepcion PendSV
 	 */
 	SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
@@ -502,46 +1410,614 @@ static void setPendSV(void) {
 	__DSB();
 }
 
-static int  comparePriorities(const void * n1vp, const void * n2vp) {
-	const os_Task_t * n1ptr = (const os_Task_t *)n1vp;
-	const os_Task_t * n2ptr = (const os_Task_t *)n2vp;
+static os_Error_t createTask(void * task, const char * name, uint32_t priority, void * arg, uint32_t * stack, size_t words, bool fpu, void * caller) {
+	os_Error_t err = OS_OK;
+
+	uint32_t id = TASK_NONE;
+
+	os_EnterCritical();
+
+	/* If there is a free slot and the priority is valid, then init the
+	 * task. The slot of a deleted task is reused with its stack */
+	if(priority < PRIORITY_LEVELS) {
+		id = taskAlloc();
+	}
+
+	if(id != TASK_NONE) {
+		initTask(id, task, name, priority, arg, stack != NULL ? stack : tasksStack[id], words, fpu);
+		readySet(&os.tasksArray[id]);
+
+		os.tasksNum++;
+	}
+
+	os_ExitCritical();
+
+	if(id == TASK_NONE) {
+		err = OS_FAIL;
+		errorRecord(OS_ERROR_TASK_CREATE, caller);
+		errorHook(NULL);
+	}
+
+	return err;
+}
+
+static void initTask(uint32_t id, void * entryPoint, const char * name, uint32_t priority, void * arg, uint32_t * stack, size_t words, bool fpu) {
+	os_Task_t * task = &os.tasksArray[id];
+	os_TaskInfo_t * info = &os.tasksInfo[id];
+
+	/* Initial stack frame. A FPU task starts with a basic frame too, its
+	 * FPU context is stacked from its first floating point instruction
+	 * (CONTROL.FPCA) */
+	stack[words - XPSR_REG_POS] = INIT_XPSR;
+	stack[words - PC_REG_POS] = (uint32_t)entryPoint;
+	stack[words - LR_REG_POS] = (uint32_t)taskReturn;
+	stack[words - R0_REG_POS] = (uint32_t)arg;
+	stack[words - LR_PREV_REG_POS] = EXC_RETURN;
+
+	/* Hot data */
+	task->sp = (uint32_t)(stack + words - FULL_STACKING_SIZE);
+	task->wakeTick = 0;
+	task->state = READY_STATE;
+	task->priority = priority;
+	task->id = id;
+	task->timerNext = TASK_NONE;
+	task->timerPrev = TASK_NONE;
+	task->timeSlice = TIME_SLICE_TICKS;
+	task->fpu = fpu;
+	reloadSlice(task);
+
+#if OS_USE_POSTMORTEM
+	/* Paint the stack below the initial context, the words never written
+	 * give its high-water mark */
+	for(size_t i = 0; i < words - FULL_STACKING_SIZE; i++) {
+		stack[i] = STACK_PAINT;
+	}
+
+	os.postMortem->tasks[id].sp = task->sp;
+#endif
+
+	/* Cold data */
+	info->stack = stack;
+	info->stackSize = words;
+	info->waiter = NULL;
+	info->entryPoint = entryPoint;
+	strncpy(info->name, name, TASK_NAME_LEN);
+	info->name[TASK_NAME_LEN] = '\0';
+}
+
+static void taskReturn(void) {
+	/* A task returned from its entry point, its slot keeps running here */
+	errorRecord(OS_ERROR_TASK_RETURN, os.tasksInfo[os.taskCurrent->id].entryPoint);
+
+	returnHook();
+}
+
+static void errorRecord(os_ErrorCode_e code, void * caller) {
+	os_EnterCritical();
+
+	os.error = code;
+
+#if OS_USE_POSTMORTEM
+	os.postMortem->error = code;
+	os.postMortem->errorTick = (uint32_t)os.tickCounter;
+	os.postMortem->errorTask = (os.taskCurrent != NULL) ? os.taskCurrent->id : TASK_NONE;
+	os.postMortem->caller = caller;
+
+	/* All the tasks are refreshed, the error hook may never return */
+	for(uint32_t i = 0; i <= IDLE_TASK_ID; i++) {
+		postMortemTask(i);
+	}
+#else
+	(void)caller;
+#endif
+
+	os_ExitCritical();
+}
+
+#if OS_USE_POSTMORTEM
+static void postMortemInit(void) {
+	os_PostMortem_t * active = &postMortems[0];
+
+	/* The previous snapshot is the valid one with the higher boot number,
+	 * after a power on reset there is none */
+	postMortemPrevious = NULL;
+
+	for(uint32_t i = 0; i < 2; i++) {
+		if(postMortems[i].magic == POSTMORTEM_MAGIC &&
+				(postMortemPrevious == NULL || TICKS_AFTER(postMortems[i].boot, postMortemPrevious->boot))) {
+			postMortemPrevious = &postMortems[i];
+		}
+	}
+
+	if(postMortemPrevious == active) {
+		active = &postMortems[1];
+	}
+
+	/* Start the snapshot of this run over the oldest one */
+	memset(active, 0, sizeof(os_PostMortem_t));
+	active->magic = POSTMORTEM_MAGIC;
+	active->boot = (postMortemPrevious != NULL) ? postMortemPrevious->boot + 1 : 0;
+	active->errorTask = TASK_NONE;
+
+	os.postMortem = active;
+	os.postMortemTask = 0;
+}
+
+static void postMortemTask(uint32_t id) {
+	os_PostMortemTask_t * record = &os.postMortem->tasks[id];
+	os_Task_t * task = &os.tasksArray[id];
+	os_TaskInfo_t * info = &os.tasksInfo[id];
+	uint32_t * stack = info->stack;
+	size_t words = info->stackSize;
+	uint32_t free = 0;
+
+	/* The stack grows down, so the painted words left are at its bottom.
+	 * The scan is not in the critical section, a word written meanwhile
+	 * only makes the mark one refresh late */
+	if(task->state != DELETED_STATE) {
+		while(free < words && stack[free] == STACK_PAINT) {
+			free++;
+		}
+	}
+
+	os_EnterCritical();
+
+	record->state = task->state;
+	record->priority = task->priority;
+
+	if(task->state != DELETED_STATE) {
+		record->stackFree = free;
+	}
+
+	os_ExitCritical();
+}
+#endif
+
+static void reloadSlice(os_Task_t * task) {
+	/* Tasks without slicing (cooperative) never consume its ticks, so any
+	 * value different from 0 means that the task can keep the CPU */
+	if(task->timeSlice > 0) {
+		task->ticksSlice = task->timeSlice;
+	}
+	else {
+		task->ticksSlice = 1;
+	}
+}
+
+static void readySet(os_Task_t * task) {
+	os.readyMask[task->priority][task->id / 32] |= 1UL << (task->id % 32);
+	os.readyPriorities |= 1UL << task->priority;
+}
+
+static void readyClear(os_Task_t * task) {
+	os.readyMask[task->priority][task->id / 32] &= ~(1UL << (task->id % 32));
+
+	for(uint32_t word = 0; word < READY_WORDS; word++) {
+		if(os.readyMask[task->priority][word] != 0) {
+			return;
+		}
+	}
+
+	os.readyPriorities &= ~(1UL << task->priority);
+}
+
+static uint32_t readyFind(uint32_t priority, uint32_t start) {
+	uint32_t word;
+	uint32_t mask;
+
+	if(start >= TASKS_MAX) {
+		start = 0;
+	}
+
+	/* First the tasks from start in its word, then the next words and
+	 * finally the whole start word again to wrap around */
+	word = start / 32;
+	mask = os.readyMask[priority][word] & (0xFFFFFFFFUL << (start % 32));
+
+	for(uint32_t count = 0; count <= READY_WORDS; count++) {
+		if(mask != 0) {
+			return word * 32 + __CLZ(__RBIT(mask));
+		}
+
+		word = (word + 1) % READY_WORDS;
+		mask = os.readyMask[priority][word];
+	}
+
+	return IDLE_TASK_ID;
+}
+
+static void timerInsert(os_Task_t * task) {
+	uint8_t * link = &os.timerHead;
+	uint8_t prev = TASK_NONE;
+
+	/* Keep the list sorted by wake up tick, tasks with the same tick are
+	 * kept in blocking order */
+	while(* link != TASK_NONE && !TICKS_AFTER(os.tasksArray[* link].wakeTick, task->wakeTick)) {
+		prev = * link;
+		link = &os.tasksArray[* link].timerNext;
+	}
+
+	task->timerNext = * link;
+	task->timerPrev = prev;
+
+	if(* link != TASK_NONE) {
+		os.tasksArray[* link].timerPrev = task->id;
+	}
+
+	* link = task->id;
+}
+
+static void timerRemove(os_Task_t * task) {
+	if(task->timerPrev != TASK_NONE) {
+		os.tasksArray[task->timerPrev].timerNext = task->timerNext;
+	}
+	else {
+		os.timerHead = task->timerNext;
+	}
+
+	if(task->timerNext != TASK_NONE) {
+		os.tasksArray[task->timerNext].timerPrev = task->timerPrev;
+	}
+
+	task->timerNext = TASK_NONE;
+	task->timerPrev = TASK_NONE;
+}
+
+static uint32_t taskAlloc(void) {
+	/* The slots of the running task and of the one a pending switch goes
+	 * to are not reused even if they were deleted, their stacks are in use
+	 * until the next context switch */
+	for(uint32_t id = 0; id < TASKS_MAX; id++) {
+		if(os.tasksArray[id].state == DELETED_STATE && &os.tasksArray[id] != os.taskCurrent && &os.tasksArray[id] != os.taskNext) {
+			return id;
+		}
+	}
+
+	return TASK_NONE;
+}
+
+#if OS_USE_TASK_CONTROL
+static void taskDetach(os_Task_t * task) {
+	os_TaskInfo_t * info = &os.tasksInfo[task->id];
+
+	os_EnterCritical();
+
+	readyClear(task);
+
+	if(task->state == BLOCKED_STATE) {
+		if(task->timerPrev != TASK_NONE || os.timerHead == task->id) {
+			timerRemove(task);
+		}
+
+		/* The object must not keep a reference to the task, a later send
+		 * or give would wake up a task that is not waiting on it */
+		if(info->waiter != NULL && * info->waiter == task) {
+			* info->waiter = NULL;
+		}
+	}
+
+	info->waiter = NULL;
+
+	os_ExitCritical();
+}
+#endif
+
+static void taskBlock(os_Task_t * task, uint32_t ticks, os_Task_t ** waiter) {
+	os_EnterCritical();
+
+	task->state = BLOCKED_STATE;
+	readyClear(task);
+
+	/* The object the task waits on is recorded, so it can be released if
+	 * the task is deleted or suspended while blocked */
+	os.tasksInfo[task->id].waiter = waiter;
+
+	if(waiter != NULL) {
+		* waiter = task;
+	}
+
+	/* Tasks blocked for ever are not in the timeouts list */
+	if(ticks != MAX_TIME_DELAY) {
+		task->wakeTick = (uint32_t)os.tickCounter + ticks;
+		timerInsert(task);
+	}
+
+	os_ExitCritical();
+}
+
+static void taskUnblock(os_Task_t * task) {
+	os_EnterCritical();
+
+	if(task->state == BLOCKED_STATE) {
+		if(task->timerPrev != TASK_NONE || os.timerHead == task->id) {
+			timerRemove(task);
+		}
+
+		task->state = READY_STATE;
+		readySet(task);
+	}
+
+	os_ExitCritical();
+}
+
+static bool waiterRelease(os_Task_t ** waiter) {
+	bool released = false;
+
+	/* Called by a task back from blocking on an object. The object is only
+	 * released if this task is still its waiter: a task suspended or
+	 * deleted while blocked was released by taskDetach(), and the object
+	 * may have another waiter now, which must keep its wakeup */
+	if(* waiter == os.taskCurrent) {
+		* waiter = NULL;
+		released = true;
+	}
+
+	os.tasksInfo[os.taskCurrent->id].waiter = NULL;
 
-	return n2ptr->priority - n1ptr->priority;
+	return released;
 }
 
-static void sortTaks(os_Task_t * array, size_t n) {
-	qsort(array, n, sizeof(os_Task_t), comparePriorities);
+static void readTimebase(uint64_t * ticks, uint32_t * elapsed) {
+	uint32_t primask = __get_PRIMASK();
+	uint32_t value;
+
+	/* The 64-bit counter can not be read atomically, so the read is done
+	 * with the interrupts masked only for a few cycles */
+	__disable_irq();
 
-	/* Re assign the IDs */
-	for(size_t i = 0; i < n; i++) {
-		array[i].id = i;
+	* ticks = os.tickCounter;
+	value = SysTick->VAL;
+
+	/* If SysTick reached zero but its handler did not run yet (called
+	 * from a higher priority ISR or with interrupts masked) the tick
+	 * counter is one tick behind the current value register */
+	if(SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) {
+		value = SysTick->VAL;
+		(* ticks)++;
 	}
+
+	__set_PRIMASK(primask);
+
+	/* SysTick counts down from LOAD to 0 */
+	* elapsed = SysTick->LOAD - value;
 }
 
+#if OS_USE_QUEUES
 static Queue_State_e queueState(Queue_t * queue) {
-	if(queue->tail == queue->head) {
+	if(queue->count == 0) {
 		return QUEUE_EMPTY_STATE;
 	}
 
-	else if(((queue->tail) / queue->size) - queue->len == 0) {
+	else if(queue->count >= queue->len) {
 		return QUEUE_FULL_STATE;
 	}
 
 	return QUEUE_AVAILABLE_STATE;
 }
 
+static size_t queueCount(Queue_t * queue) {
+	return queue->count;
+}
+
+static void queueCopyIn(Queue_t * queue, const uint8_t * data, size_t n) {
+	size_t first = queue->len - queue->tail;
+
+	/* At most two copies, before and after the end of the ring */
+	if(first > n) {
+		first = n;
+	}
+
+	memcpy(queue->data + queue->tail * queue->size, data, first * queue->size);
+	memcpy(queue->data, data + first * queue->size, (n - first) * queue->size);
+
+	queue->tail = (queue->tail + n) % queue->len;
+	queue->count += n;
+}
+
+static void queueCopyOut(Queue_t * queue, uint8_t * data, size_t n) {
+	size_t first = queue->len - queue->head;
+
+	if(first > n) {
+		first = n;
+	}
+
+	memcpy(data, queue->data + queue->head * queue->size, first * queue->size);
+	memcpy(data + first * queue->size, queue->data, (n - first) * queue->size);
+
+	queue->head = (queue->head + n) % queue->len;
+	queue->count -= n;
+}
+#endif
+
+#if OBJECT_STATS
+static void objectRegister(os_Object_t * object, os_ObjectType_e type) {
+	os_Object_t ** link = &objects;
+
+	os_EnterCritical();
+
+	/* The object is looked up by its address only, the memory of an object
+	 * not registered yet is not read. An object initialized again keeps its
+	 * place in the registry */
+	while(* link != NULL && * link != object) {
+		link = &(* link)->next;
+	}
+
+	if(* link == NULL) {
+		object->next = objects;
+		objects = object;
+	}
+
+	object->name = NULL;
+	object->type = type;
+	memset(&object->stats, 0, sizeof(os_ObjectStats_t));
+
+	os_ExitCritical();
+}
+
+static void objectPeak(os_Object_t * object, uint32_t value) {
+	if(value > object->stats.peak) {
+		object->stats.peak = value;
+	}
+}
+
+static void objectBlocked(os_Object_t * object, uint32_t start) {
+	uint32_t ticks = TICKS_DIFF((uint32_t)os.tickCounter, start);
+
+	object->stats.blocks++;
+	object->stats.blockTime += ticks;
+
+	if(ticks > object->stats.blockMax) {
+		object->stats.blockMax = ticks;
+	}
+}
+#endif
+
+#if OS_USE_QUEUE_SETS
+static void notifySet(struct QueueSet_s * set) {
+	/* Wake up the task blocked on the set and schedule it right away */
+	if(set->task != NULL) {
+		taskUnblock(set->task);
+		reschedule();
+	}
+}
+
+static void * readySetMember(QueueSet_t * set) {
+	size_t index = set->last;
+
+	/* Search starting after the last member selected, so a member always
+	 * ready can not starve the others */
+	for(size_t count = 0; count < set->len; count++) {
+		index++;
+
+		if(index >= set->len) {
+			index = 0;
+		}
+
+		if(set->members[index].type == QUEUE_SET_QUEUE) {
+			if(queueState((Queue_t *)set->members[index].handle) != QUEUE_EMPTY_STATE) {
+				set->last = index;
+				return set->members[index].handle;
+			}
+		}
+		else {
+			if(((Semaphore_t *)set->members[index].handle)->isGiven == true) {
+				set->last = index;
+				return set->members[index].handle;
+			}
+		}
+	}
+
+	return NULL;
+}
+#endif
+
+#if OS_USE_IRQ_RATE_LIMIT
+static bool irqCoalesce(os_IRQCoalesce_t * coalesce, void * arg) {
+	uint64_t timestamp;
+	uint32_t now;
+
+	os_GetTimeUs(&timestamp);
+	now = (uint32_t)timestamp;
+
+	/* Delivery of the events merged in the last window, pended by the
+	 * SysTick handler that already opened the next window */
+	if(coalesce->deliver == true) {
+		coalesce->deliver = false;
+		coalesce->events = coalesce->pending;
+		coalesce->pending.count = 0;
+		coalesce->stats.delivered++;
+
+		return true;
+	}
+
+	/* First event, delivered right away */
+	if(coalesce->open == false) {
+		coalesce->open = true;
+		coalesce->windowEnd = (uint32_t)os.tickCounter + coalesce->window;
+		coalesce->events.count = 1;
+		coalesce->events.first = now;
+		coalesce->events.last = now;
+		coalesce->stats.delivered++;
+
+		return true;
+	}
+
+	/* Event inside the window, merged into the next delivery */
+	if(coalesce->pending.count == 0) {
+		coalesce->pending.first = now;
+	}
+
+	coalesce->pending.count++;
+	coalesce->pending.last = now;
+	coalesce->stats.merged++;
+
+	if(coalesce->ack != NULL) {
+		coalesce->ack(arg);
+	}
+	else {
+		NVIC_DisableIRQ(coalesce->irq);
+		coalesce->stats.masked++;
+	}
+
+	return false;
+}
+
+static void irqWindows(uint32_t now) {
+	for(uint32_t i = 0; i < IRQ_COALESCE_MAX; i++) {
+		os_IRQCoalesce_t * coalesce = &coalesceTable[i];
+
+		if(coalesce->window == 0 || coalesce->open == false || TICKS_AFTER(coalesce->windowEnd, now)) {
+			continue;
+		}
+
+		/* If events were merged, then the next window starts with their
+		 * delivery in the IRQ context, otherwise the window is closed */
+		if(coalesce->pending.count > 0) {
+			coalesce->deliver = true;
+			coalesce->windowEnd = now + coalesce->window;
+
+			if(coalesce->ack == NULL) {
+				NVIC_EnableIRQ(coalesce->irq);
+			}
+
+			NVIC_SetPendingIRQ(coalesce->irq);
+		}
+		else {
+			coalesce->open = false;
+		}
+	}
+}
+#endif
+
+#if OS_USE_IRQS
 static void IRQHandler(LPC43XX_IRQn_Type IRQn) {
 	os_State_e previousState = os.state;
 	void (* handler)(void *) = isrHandler[IRQn].handler;
 	void * arg = (void *)isrHandler[IRQn].arg;
+	bool deliver = true;
 
 	os.state = IRQ_RUN_STATE;
 
-	handler(arg);
+	/* The pending flag is cleared before the handler runs, so an IRQ
+	 * pended again while it runs (a new edge, a software post) is not
+	 * lost */
+	NVIC_ClearPendingIRQ(IRQn);
 
-	os.state = previousState;
+#if OS_USE_IRQ_RATE_LIMIT
+	/* The handler of a rate limited IRQ is not called for the events
+	 * merged inside a window. The window is shared with the SysTick */
+	if(isrHandler[IRQn].coalesce != IRQ_COALESCE_NONE) {
+		os_EnterCritical();
+		deliver = irqCoalesce(&coalesceTable[isrHandler[IRQn].coalesce], arg);
+		os_ExitCritical();
+	}
+#endif
 
-	NVIC_ClearPendingIRQ(IRQn);
+	if(deliver == true) {
+		handler(arg);
+	}
+
+	os.state = previousState;
 }
 
 /* Interrupt service routines */
@@ -595,5 +2071,6 @@ void WDT_IRQHandler(void){IRQHandler(         WWDT_IRQn        );}
 void M0SUB_IRQHandler(void){IRQHandler(       M0SUB_IRQn       );}
 void CAN0_IRQHandler(void){IRQHandler(        C_CAN0_IRQn      );}
 void QEI_IRQHandler(void){IRQHandler(         QEI_IRQn         );}
+#endif
 
 /* end of file ---------------------------------------------------------------*/
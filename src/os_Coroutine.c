@@ -0,0 +1,131 @@
+/*
+ * os_Coroutine.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Coroutine.h"
+
+#if OS_USE_COROUTINES
+
+/* macros --------------------------------------------------------------------*/
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+/* external data declaration -------------------------------------------------*/
+
+/* internal functions declaration --------------------------------------------*/
+
+/* external functions definition ---------------------------------------------*/
+
+os_Error_t Coroutine_Init(Coroutine_t * const me, Coroutine_Function_t function, void * arg) {
+	os_Error_t err = OS_OK;
+
+	if(function == NULL) {
+		return OS_FAIL;
+	}
+
+	me->function = function;
+	me->arg = arg;
+	me->next = NULL;
+	me->wakeTick = 0;
+	me->line = 0;
+	me->state = COROUTINE_RUN_STATE;
+
+	return err;
+}
+
+uint32_t Coroutine_Now(void) {
+	uint32_t ticks;
+
+	os_GetTickCounter(&ticks);
+
+	return ticks;
+}
+
+os_Error_t CoScheduler_Init(CoScheduler_t * const me) {
+	os_Error_t err = OS_OK;
+
+	me->head = NULL;
+	me->tail = NULL;
+
+	return err;
+}
+
+os_Error_t CoScheduler_Add(CoScheduler_t * const me, Coroutine_t * const coroutine) {
+	os_Error_t err = OS_OK;
+
+	coroutine->next = NULL;
+
+	if(me->tail == NULL) {
+		me->head = coroutine;
+	}
+	else {
+		me->tail->next = coroutine;
+	}
+
+	me->tail = coroutine;
+
+	return err;
+}
+
+void CoScheduler_Task(void * arg) {
+	CoScheduler_t * me = (CoScheduler_t *)arg;
+
+	for(;;) {
+		Coroutine_t * prev = NULL;
+		Coroutine_t * co = me->head;
+		bool progress = false;
+
+		while(co != NULL) {
+			uint16_t line = co->line;
+
+			/* Resume the coroutine. A yield only lasts until the next pass */
+			co->state = COROUTINE_RUN_STATE;
+			co->function(co);
+
+			if(co->line != line || co->state != COROUTINE_RUN_STATE) {
+				progress = true;
+			}
+
+			/* Remove the coroutines ended */
+			if(co->state == COROUTINE_DONE_STATE) {
+				if(prev == NULL) {
+					me->head = co->next;
+				}
+				else {
+					prev->next = co->next;
+				}
+
+				if(me->tail == co) {
+					me->tail = prev;
+				}
+			}
+			else {
+				prev = co;
+			}
+
+			co = co->next;
+		}
+
+		/* If any coroutine made progress, then run another pass right after
+		 * the tasks with the same priority, otherwise sleep */
+		if(progress == true) {
+			os_Yield();
+		}
+		else {
+			os_TaskDelay(COROUTINE_PERIOD);
+		}
+	}
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+#endif /* #if OS_USE_COROUTINES */
+
+/* end of file ---------------------------------------------------------------*/
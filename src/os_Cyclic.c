@@ -0,0 +1,127 @@
+/*
+ * os_Cyclic.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Cyclic.h"
+
+#if OS_USE_CYCLIC
+
+/* macros --------------------------------------------------------------------*/
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+/* external data declaration -------------------------------------------------*/
+
+/* internal functions declaration --------------------------------------------*/
+
+static void executive(void * arg);
+static uint32_t timestamp(void);
+
+/* external functions definition ---------------------------------------------*/
+
+os_Error_t Cyclic_Start(Cyclic_t * const me, const Cyclic_Frame_t * table, size_t frames, uint32_t frameTicks) {
+	os_Error_t err = OS_OK;
+
+	/* Return with error if the parameters are not valid */
+	if(table == NULL || frames == 0 || frameTicks == 0) {
+		return OS_FAIL;
+	}
+
+	/* The jobs of each frame must fit in the frame */
+	for(size_t i = 0; i < frames; i++) {
+		uint32_t wcet = 0;
+
+		for(size_t j = 0; j < table[i].len; j++) {
+			wcet += table[i].jobs[j].wcet;
+		}
+
+		if(wcet > frameTicks * SYSTICK_TIME) {
+			return OS_FAIL;
+		}
+	}
+
+	me->table = table;
+	me->frames = frames;
+	me->frameTicks = frameTicks;
+	me->frame = 0;
+	me->overruns = 0;
+	me->skipped = 0;
+	me->maxTime = 0;
+
+	err = os_CreateTaskReserved(executive, "Cyclic", me);
+
+	return err;
+}
+
+void __attribute__((weak)) cyclicOverrunHook(Cyclic_t * const me, size_t frame) {
+	__asm volatile( "nop" );
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static void executive(void * arg) {
+	Cyclic_t * me = (Cyclic_t *)arg;
+	uint32_t now;
+
+	/* The frames are not preempted by other tasks of the same priority */
+	os_SetTimeSlice(0);
+	os_GetTickCounter(&me->wake);
+
+	for(;;) {
+		const Cyclic_Frame_t * frame = &me->table[me->frame];
+		uint32_t start = timestamp();
+		uint32_t elapsed;
+
+		for(size_t j = 0; j < frame->len; j++) {
+			frame->jobs[j].job(frame->jobs[j].arg);
+		}
+
+		elapsed = timestamp() - start;
+
+		if(elapsed > me->maxTime) {
+			me->maxTime = elapsed;
+		}
+
+		/* Wait for the start of the next frame */
+		if(os_TaskDelayUntil(&me->wake, me->frameTicks) != OS_OK) {
+			me->overruns++;
+			cyclicOverrunHook(me, me->frame);
+
+			/* Skip the frames whose start already passed and wait for the
+			 * next one. The tick can move on between the check and the
+			 * wait, then the skip is done again */
+			do {
+				os_GetTickCounter(&now);
+
+				while(!TICKS_AFTER(me->wake, now)) {
+					me->wake += me->frameTicks;
+					me->frame = (me->frame + 1) % me->frames;
+					me->skipped++;
+				}
+
+				me->wake -= me->frameTicks;
+			} while(os_TaskDelayUntil(&me->wake, me->frameTicks) != OS_OK);
+		}
+
+		me->frame = (me->frame + 1) % me->frames;
+	}
+}
+
+static uint32_t timestamp(void) {
+	uint64_t us;
+
+	os_GetTimeUs(&us);
+
+	return (uint32_t)us;
+}
+
+#endif /* #if OS_USE_CYCLIC */
+
+/* end of file ---------------------------------------------------------------*/
@@ -0,0 +1,116 @@
+/*
+ * os_Dma.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Dma.h"
+
+#if OS_USE_DMA
+
+/* macros --------------------------------------------------------------------*/
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+/* external data declaration -------------------------------------------------*/
+
+/* Channels callbacks */
+static Dma_Channel_t channels[DMA_CHANNELS_NUM];
+
+/* DMA controller initialized flag */
+static bool initialized = false;
+
+/* internal functions declaration --------------------------------------------*/
+
+static void dmaISR(void * arg);
+
+/* external functions definition ---------------------------------------------*/
+
+os_Error_t Dma_Init(void) {
+	os_Error_t err = OS_OK;
+
+	if(initialized == false) {
+		Chip_GPDMA_Init(LPC_GPDMA);
+
+		err = os_InstallIRQ(DMA_IRQn, dmaISR, NULL);
+
+		if(err == OS_OK) {
+			initialized = true;
+		}
+	}
+
+	return err;
+}
+
+os_Error_t Dma_Open(uint32_t peripheral, Dma_Callback_t callback, void * arg, uint8_t * channel) {
+	os_Error_t err = OS_OK;
+	uint8_t ch;
+
+	/* Return with error if the controller is not initialized */
+	if(initialized == false || callback == NULL) {
+		return OS_FAIL;
+	}
+
+	os_EnterCritical();
+
+	ch = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, peripheral);
+
+	/* The chip library returns the channel 0 when all are busy, so it
+	 * is a valid channel only if it has not a callback */
+	if(channels[ch].callback == NULL) {
+		channels[ch].callback = callback;
+		channels[ch].arg = arg;
+		* channel = ch;
+	}
+	else {
+		err = OS_FAIL;
+	}
+
+	os_ExitCritical();
+
+	return err;
+}
+
+os_Error_t Dma_Close(uint8_t channel) {
+	os_Error_t err = OS_OK;
+
+	/* Return with error if the channel is not open */
+	if(channel >= DMA_CHANNELS_NUM || channels[channel].callback == NULL) {
+		return OS_FAIL;
+	}
+
+	os_EnterCritical();
+
+	Chip_GPDMA_Stop(LPC_GPDMA, channel);
+	channels[channel].callback = NULL;
+	channels[channel].arg = NULL;
+
+	os_ExitCritical();
+
+	return err;
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static void dmaISR(void * arg) {
+	uint32_t status = LPC_GPDMA->INTSTAT;
+
+	/* Dispatch the interrupt of each channel to its callback. The chip
+	 * library clears the terminal count and error flags */
+	for(uint8_t ch = 0; ch < DMA_CHANNELS_NUM; ch++) {
+		if((status & (1 << ch)) && channels[ch].callback != NULL) {
+			bool ok = (Chip_GPDMA_Interrupt(LPC_GPDMA, ch) == SUCCESS);
+
+			channels[ch].callback(channels[ch].arg, ok);
+		}
+	}
+}
+
+#endif /* #if OS_USE_DMA */
+
+/* end of file ---------------------------------------------------------------*/
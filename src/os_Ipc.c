@@ -0,0 +1,281 @@
+/*
+ * os_Ipc.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Ipc.h"
+
+#if OS_USE_IPC
+
+/* macros --------------------------------------------------------------------*/
+
+#define SLOT_BITS	8	/**< Bits of the call ID for the pending slot */
+
+/* typedef -------------------------------------------------------------------*/
+
+/**
+ * @brief Call waiting for its response on the M4.
+ */
+typedef struct {
+	Semaphore_t done;	/**< Given when the response arrives */
+	uint32_t id;		/**< Call ID */
+	uint32_t result;	/**< Command result */
+	bool busy;			/**< Slot in use */
+	bool completed;		/**< Response received */
+} Ipc_Pending_t;
+
+/* internal data declaration -------------------------------------------------*/
+
+/* Shared memory, linked at the same address by the M4 and the M0 images.
+ * With IPC_SHARED_EXTERN the M0 side uses the definition of the M4 side,
+ * so both can be linked in one program as the host tests do */
+#if defined(CORE_M0) && defined(IPC_SHARED_EXTERN)
+extern Ipc_Shared_t ipcShared;
+#else
+Ipc_Shared_t ipcShared __attribute__((section(IPC_SECTION)));
+#endif
+
+#ifndef CORE_M0
+/* Calls waiting for a response */
+static Ipc_Pending_t pending[IPC_PENDING_MAX];
+
+/* Generation of the call IDs, a late response of a call that timed out
+ * does not match the next call of the same slot */
+static uint32_t generation;
+#endif
+
+/* external data declaration -------------------------------------------------*/
+
+/* internal functions declaration --------------------------------------------*/
+
+static bool ringPush(Ipc_Ring_t * ring, const Ipc_Message_t * message);
+static bool ringPop(Ipc_Ring_t * ring, Ipc_Message_t * message);
+static void doorbell(void);
+#ifndef CORE_M0
+static void m0ISR(void * arg);
+#endif
+
+/* external functions definition ---------------------------------------------*/
+
+#ifndef CORE_M0
+
+os_Error_t Ipc_Init(void) {
+	os_Error_t err = OS_OK;
+
+	memset(&ipcShared, 0, sizeof(ipcShared));
+
+	for(uint32_t i = 0; i < IPC_PENDING_MAX; i++) {
+		Semaphore_Init(&pending[i].done);
+		pending[i].busy = false;
+	}
+
+	/* The M0 rings the doorbell when it writes a response */
+	LPC_CREG->M0APPTXEVENT = 0;
+	err = os_InstallIRQ(M0APP_IRQn, m0ISR, NULL);
+
+	return err;
+}
+
+os_Error_t Ipc_StartM0(const void * image, uint32_t ticks) {
+	os_Error_t err = OS_OK;
+	uint32_t start;
+	uint32_t now;
+
+	if(((uint32_t)image & 0xFFF) != 0) {
+		return OS_FAIL;
+	}
+
+	/* Keep the M0 in reset while its memory map changes. The calls fail
+	 * until the new image is serving */
+	Chip_RGU_TriggerReset(RGU_M0APP_RST);
+	ipcShared.ready = 0;
+	LPC_CREG->M0APPMEMMAP = (uint32_t)image;
+	Chip_RGU_ClearReset(RGU_M0APP_RST);
+
+	/* Wait for the dispatcher, a request sent before it runs would only
+	 * time out */
+	os_GetTickCounter(&start);
+
+	while(ipcShared.ready != IPC_READY) {
+		os_GetTickCounter(&now);
+
+		if(TICKS_DIFF(now, start) >= ticks) {
+			err = OS_FAIL;
+			break;
+		}
+
+		os_TaskDelay(1);
+	}
+
+	return err;
+}
+
+os_Error_t Ipc_Call(uint32_t command, uint32_t arg, uint32_t * result, uint32_t ticks) {
+	os_Error_t err = OS_OK;
+	Ipc_Pending_t * call = NULL;
+	Ipc_Message_t message;
+	uint32_t slot;
+
+	/* Return with error if the M0 is not serving */
+	if(ipcShared.ready != IPC_READY) {
+		return OS_FAIL;
+	}
+
+	os_EnterCritical();
+
+	/* Take a free slot. The tasks are the producers of the requests ring,
+	 * they are serialized by the critical section */
+	for(slot = 0; slot < IPC_PENDING_MAX; slot++) {
+		if(pending[slot].busy == false) {
+			call = &pending[slot];
+			break;
+		}
+	}
+
+	if(call != NULL) {
+		generation++;
+		call->id = (generation << SLOT_BITS) | slot;
+		call->busy = true;
+		call->completed = false;
+
+		message.id = call->id;
+		message.command = command;
+		message.arg = arg;
+		message.result = 0;
+
+		if(ringPush(&ipcShared.requests, &message) == false) {
+			call->busy = false;
+			call = NULL;
+		}
+	}
+
+	os_ExitCritical();
+
+	if(call == NULL) {
+		return OS_FAIL;
+	}
+
+	doorbell();
+
+	Semaphore_TakeTimeout(&call->done, ticks);
+
+	os_EnterCritical();
+
+	if(call->completed == true) {
+		if(result != NULL) {
+			* result = call->result;
+		}
+	}
+	else {
+		err = OS_FAIL;
+	}
+
+	/* The response could arrive right after the timeout */
+	Semaphore_TryTake(&call->done);
+	call->busy = false;
+
+	os_ExitCritical();
+
+	return err;
+}
+
+#else
+
+void Ipc_Serve(Ipc_Handler_t handler) {
+	Ipc_Message_t message;
+
+	NVIC_EnableIRQ(M0_M4CORE_IRQn);
+	ipcShared.ready = IPC_READY;
+
+	for(;;) {
+		while(ringPop(&ipcShared.requests, &message) == true) {
+			message.result = handler(message.command, message.arg);
+
+			/* The M4 frees a slot of the responses ring in its ISR */
+			while(ringPush(&ipcShared.responses, &message) == false) {
+				doorbell();
+			}
+
+			doorbell();
+		}
+
+		/* The doorbell of the M4 wakes up the core */
+		__WFI();
+	}
+}
+
+void M4_IRQHandler(void) {
+	LPC_CREG->M4TXEVENT = 0;
+}
+
+#endif
+
+/* internal functions definition ---------------------------------------------*/
+
+static bool ringPush(Ipc_Ring_t * ring, const Ipc_Message_t * message) {
+	uint32_t tail = ring->tail;
+
+	if(tail - ring->head == IPC_RING_LEN) {
+		return false;
+	}
+
+	ring->messages[tail & (IPC_RING_LEN - 1)] = * message;
+
+	/* The message is written before it is published to the other core */
+	__DMB();
+	ring->tail = tail + 1;
+
+	return true;
+}
+
+static bool ringPop(Ipc_Ring_t * ring, Ipc_Message_t * message) {
+	uint32_t head = ring->head;
+
+	if(head == ring->tail) {
+		return false;
+	}
+
+	/* The message is read after its publication was seen */
+	__DMB();
+	* message = ring->messages[head & (IPC_RING_LEN - 1)];
+
+	/* The message is read before its slot is given back */
+	__DMB();
+	ring->head = head + 1;
+
+	return true;
+}
+
+static void doorbell(void) {
+	/* The ring is written to memory before the other core is signaled */
+	__DSB();
+	__SEV();
+}
+
+#ifndef CORE_M0
+static void m0ISR(void * arg) {
+	Ipc_Message_t message;
+
+	LPC_CREG->M0APPTXEVENT = 0;
+
+	/* Complete all the calls answered. The responses of the calls that
+	 * timed out are discarded */
+	while(ringPop(&ipcShared.responses, &message) == true) {
+		Ipc_Pending_t * call = &pending[(message.id & ((1 << SLOT_BITS) - 1)) % IPC_PENDING_MAX];
+
+		if(call->busy == true && call->id == message.id) {
+			call->result = message.result;
+			call->completed = true;
+			Semaphore_Give(&call->done);
+		}
+	}
+}
+#endif
+
+#endif /* #if OS_USE_IPC */
+
+/* end of file ---------------------------------------------------------------*/
@@ -0,0 +1,126 @@
+/*
+ * os_Log.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Log.h"
+
+#if OS_USE_LOG
+
+/* macros --------------------------------------------------------------------*/
+
+#define LOG_TASK_PERIOD		10	/**< Log task polling period in ticks */
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+/* external data declaration -------------------------------------------------*/
+
+/* Log instance */
+Log_t logBuffer;
+
+/* internal functions declaration --------------------------------------------*/
+
+/* external functions definition ---------------------------------------------*/
+
+os_Error_t Log_Write(const char * fmt, uint32_t nargs, ...) {
+	os_Error_t err = OS_OK;
+	Log_Record_t * record;
+	uint64_t cycles;
+	uint32_t head;
+	va_list args;
+
+	/* Reserve a record without locks, so it can be called from any task or
+	 * ISR. If the ring is full the record is dropped */
+	do {
+		head = __LDREXW(&logBuffer.head);
+
+		if(head - logBuffer.tail >= LOG_RECORDS) {
+			__CLREX();
+
+			do {
+				head = __LDREXW(&logBuffer.dropped);
+			} while(__STREXW(head + 1, &logBuffer.dropped));
+
+			return OS_FAIL;
+		}
+	} while(__STREXW(head + 1, &logBuffer.head));
+
+	os_GetCycles(&cycles);
+
+	record = &logBuffer.records[head & (LOG_RECORDS - 1)];
+	record->id = (uint32_t)fmt;
+	record->timestamp = (uint32_t)cycles;
+	record->nargs = nargs > LOG_ARGS_MAX ? LOG_ARGS_MAX : nargs;
+
+	va_start(args, nargs);
+
+	for(uint32_t i = 0; i < record->nargs; i++) {
+		record->args[i] = va_arg(args, uint32_t);
+	}
+
+	va_end(args);
+
+	/* Commit the record after all its fields are written */
+	__DMB();
+	record->seq = head + 1;
+
+	return err;
+}
+
+os_Error_t Log_Read(Log_Record_t * record) {
+	os_Error_t err = OS_OK;
+	uint32_t tail = logBuffer.tail;
+	Log_Record_t * oldest = &logBuffer.records[tail & (LOG_RECORDS - 1)];
+
+	/* The record is reserved but not committed yet, or the ring is empty */
+	if(tail == logBuffer.head || oldest->seq != tail + 1) {
+		return OS_FAIL;
+	}
+
+	* record = * oldest;
+
+	/* Release the record after it was copied */
+	__DMB();
+	logBuffer.tail = tail + 1;
+
+	return err;
+}
+
+void Log_Task(void * arg) {
+	Uart_t * uart = (Uart_t *)arg;
+	Log_Record_t record;
+	uint8_t frame[2 + 2 * sizeof(uint32_t) + LOG_ARGS_MAX * sizeof(uint32_t)];
+
+	for(;;) {
+		while(Log_Read(&record) == OS_OK) {
+			size_t len = 0;
+
+			/* Frame: sync, number of arguments, format string address,
+			 * timestamp and arguments, all little endian */
+			frame[len++] = LOG_FRAME_SYNC;
+			frame[len++] = (uint8_t)record.nargs;
+			memcpy(&frame[len], &record.id, sizeof(uint32_t));
+			len += sizeof(uint32_t);
+			memcpy(&frame[len], &record.timestamp, sizeof(uint32_t));
+			len += sizeof(uint32_t);
+			memcpy(&frame[len], record.args, record.nargs * sizeof(uint32_t));
+			len += record.nargs * sizeof(uint32_t);
+
+			Uart_Write(uart, frame, len);
+		}
+
+		os_TaskDelay(LOG_TASK_PERIOD);
+	}
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+#endif /* #if OS_USE_LOG */
+
+/* end of file ---------------------------------------------------------------*/
@@ -0,0 +1,167 @@
+/*
+ * os_Probe.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Probe.h"
+
+#if OS_USE_PROBES
+
+/* macros --------------------------------------------------------------------*/
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+/* external data declaration -------------------------------------------------*/
+
+/* internal functions declaration --------------------------------------------*/
+
+static uint8_t * putVarint(uint8_t * buffer, uint32_t value);
+
+/* external functions definition ---------------------------------------------*/
+
+os_Error_t Probe_Init(Probe_t * const me, const char * name, uint32_t budget) {
+	os_Error_t err = OS_OK;
+
+	me->name = name;
+	me->budget = budget;
+	me->start = 0;
+
+	Probe_Reset(me);
+
+	return err;
+}
+
+uint32_t Probe_Now(void) {
+	uint64_t us;
+
+	/* The lower 32 bits are enough, the differences are wrap-safe */
+	os_GetTimeUs(&us);
+
+	return (uint32_t)us;
+}
+
+os_Error_t Probe_Record(Probe_t * const me, uint32_t start) {
+	os_Error_t err = OS_OK;
+	uint32_t latency = Probe_Now() - start;
+	uint32_t bucket;
+
+	/* Log2 bucket, one CLZ instead of a search */
+	bucket = 32 - __CLZ(latency);
+
+	if(bucket >= PROBE_BUCKETS) {
+		bucket = PROBE_BUCKETS - 1;
+	}
+
+	os_EnterCritical();
+
+	me->buckets[bucket]++;
+	me->count++;
+
+	if(latency < me->min) {
+		me->min = latency;
+	}
+
+	if(latency > me->max) {
+		me->max = latency;
+	}
+
+	if(me->budget != 0 && latency > me->budget) {
+		me->misses++;
+		err = OS_FAIL;
+	}
+
+	os_ExitCritical();
+
+	if(err != OS_OK) {
+		probeDeadlineHook(me, latency);
+	}
+
+	return err;
+}
+
+os_Error_t Probe_Start(Probe_t * const me) {
+	os_Error_t err = OS_OK;
+
+	me->start = Probe_Now();
+
+	return err;
+}
+
+os_Error_t Probe_Stop(Probe_t * const me) {
+	return Probe_Record(me, me->start);
+}
+
+os_Error_t Probe_Reset(Probe_t * const me) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	me->count = 0;
+	me->min = UINT32_MAX;
+	me->max = 0;
+	me->misses = 0;
+	memset(me->buckets, 0, sizeof(me->buckets));
+
+	os_ExitCritical();
+
+	return err;
+}
+
+os_Error_t Probe_Export(Probe_t * const me, uint8_t * buffer, size_t size, size_t * len) {
+	os_Error_t err = OS_OK;
+	Probe_t copy;
+	uint8_t * p = buffer;
+
+	if(size < PROBE_EXPORT_SIZE) {
+		return OS_FAIL;
+	}
+
+	/* Consistent snapshot, the probe keeps recording */
+	os_EnterCritical();
+	copy = * me;
+	os_ExitCritical();
+
+	* p++ = PROBE_EXPORT_MAGIC;
+	* p++ = PROBE_BUCKETS;
+	p = putVarint(p, copy.count);
+	p = putVarint(p, copy.count > 0 ? copy.min : 0);
+	p = putVarint(p, copy.max);
+	p = putVarint(p, copy.misses);
+
+	for(uint32_t i = 0; i < PROBE_BUCKETS; i++) {
+		p = putVarint(p, copy.buckets[i]);
+	}
+
+	* len = p - buffer;
+
+	return err;
+}
+
+void __attribute__((weak)) probeDeadlineHook(Probe_t * const me, uint32_t latency) {
+	__asm volatile( "nop" );
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static uint8_t * putVarint(uint8_t * buffer, uint32_t value) {
+	/* 7 bits per byte, the high bit set if more bytes follow. The empty
+	 * buckets take one byte */
+	while(value >= 0x80) {
+		* buffer++ = (value & 0x7F) | 0x80;
+		value >>= 7;
+	}
+
+	* buffer++ = value;
+
+	return buffer;
+}
+
+#endif /* #if OS_USE_PROBES */
+
+/* end of file ---------------------------------------------------------------*/
@@ -0,0 +1,100 @@
+/*
+ * os_SeqLock.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_SeqLock.h"
+
+#if OS_USE_SEQLOCKS
+
+/* macros --------------------------------------------------------------------*/
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+/* external data declaration -------------------------------------------------*/
+
+/* internal functions declaration --------------------------------------------*/
+
+/* external functions definition ---------------------------------------------*/
+
+os_Error_t SeqLock_Init(SeqLock_t * const me) {
+	os_Error_t err = OS_OK;
+
+	me->sequence = 0;
+
+	return err;
+}
+
+os_Error_t SeqLock_WriteBegin(SeqLock_t * const me) {
+	os_Error_t err = OS_OK;
+
+	/* The sequence is odd before any byte of the data is written */
+	me->sequence++;
+	__DMB();
+
+	return err;
+}
+
+os_Error_t SeqLock_WriteEnd(SeqLock_t * const me) {
+	os_Error_t err = OS_OK;
+
+	/* All the data is written before the sequence is even again */
+	__DMB();
+	me->sequence++;
+
+	return err;
+}
+
+uint32_t SeqLock_ReadBegin(SeqLock_t * const me) {
+	uint32_t sequence;
+
+	do {
+		sequence = me->sequence;
+	} while((sequence & 1) != 0);
+
+	/* The sequence is read before the data */
+	__DMB();
+
+	return sequence;
+}
+
+bool SeqLock_ReadRetry(SeqLock_t * const me, uint32_t sequence) {
+	/* The data is read before the sequence is checked again */
+	__DMB();
+
+	return me->sequence != sequence;
+}
+
+os_Error_t SeqLock_Write(SeqLock_t * const me, void * dst, const void * src, size_t size) {
+	os_Error_t err = OS_OK;
+
+	SeqLock_WriteBegin(me);
+	memcpy(dst, src, size);
+	SeqLock_WriteEnd(me);
+
+	return err;
+}
+
+os_Error_t SeqLock_Read(SeqLock_t * const me, void * dst, const void * src, size_t size) {
+	os_Error_t err = OS_OK;
+	uint32_t sequence;
+
+	do {
+		sequence = SeqLock_ReadBegin(me);
+		memcpy(dst, src, size);
+	} while(SeqLock_ReadRetry(me, sequence) == true);
+
+	return err;
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+#endif /* #if OS_USE_SEQLOCKS */
+
+/* end of file ---------------------------------------------------------------*/
@@ -0,0 +1,242 @@
+/*
+ * os_Stream.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Stream.h"
+
+#if OS_USE_STREAMS
+
+/* macros --------------------------------------------------------------------*/
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+/* external data declaration -------------------------------------------------*/
+
+/* internal functions declaration --------------------------------------------*/
+
+static void ringCopyIn(Stream_t * const me, uint32_t pos, const uint8_t * data, uint32_t len);
+static void ringCopyOut(Stream_t * const me, uint32_t pos, uint8_t * data, uint32_t len);
+static void commit(Stream_t * const me, uint32_t tail);
+static uint32_t wait(Stream_t * const me, uint32_t bytes, uint32_t ticks);
+
+/* external functions definition ---------------------------------------------*/
+
+os_Error_t Stream_Init(Stream_t * const me, uint8_t * buffer, size_t size, size_t trigger) {
+	os_Error_t err = OS_OK;
+
+	/* Return with error if the parameters are not valid. The size is a
+	 * power of 2, so the indexes are masked instead of divided */
+	if(buffer == NULL || size == 0 || (size & (size - 1)) != 0 || trigger > size) {
+		return OS_FAIL;
+	}
+
+	me->buffer = buffer;
+	me->size = size;
+	me->head = 0;
+	me->tail = 0;
+	me->trigger = trigger > 0 ? trigger : 1;
+	me->waiting = 0;
+	Semaphore_Init(&me->ready);
+
+	return err;
+}
+
+os_Error_t Stream_Write(Stream_t * const me, const void * data, size_t len, size_t * written) {
+	os_Error_t err = OS_OK;
+	uint32_t tail = me->tail;
+	uint32_t space = me->size - (tail - me->head);
+
+	if(len > space) {
+		len = space;
+		err = OS_FAIL;
+	}
+
+	if(len > 0) {
+		ringCopyIn(me, tail, data, len);
+		commit(me, tail + len);
+	}
+
+	if(written != NULL) {
+		* written = len;
+	}
+
+	return err;
+}
+
+os_Error_t Stream_Read(Stream_t * const me, void * data, size_t len, size_t * received, uint32_t ticks) {
+	os_Error_t err = OS_OK;
+	uint32_t head = me->head;
+	uint32_t available;
+
+	available = wait(me, len < me->trigger ? len : me->trigger, ticks);
+
+	if(available > len) {
+		available = len;
+	}
+
+	if(available > 0) {
+		ringCopyOut(me, head, data, available);
+
+		/* The bytes are copied before the space is given back */
+		__DMB();
+		me->head = head + available;
+	}
+	else {
+		err = OS_FAIL;
+	}
+
+	if(received != NULL) {
+		* received = available;
+	}
+
+	return err;
+}
+
+os_Error_t Stream_WriteMessage(Stream_t * const me, const void * data, size_t len) {
+	os_Error_t err = OS_OK;
+	uint32_t tail = me->tail;
+	uint16_t header = len;
+
+	/* The message is written only if it fits whole */
+	if(len > UINT16_MAX || STREAM_HEADER_SIZE + len > me->size - (tail - me->head)) {
+		return OS_FAIL;
+	}
+
+	ringCopyIn(me, tail, (const uint8_t *)&header, STREAM_HEADER_SIZE);
+	ringCopyIn(me, tail + STREAM_HEADER_SIZE, data, len);
+
+	/* The length and the payload are published at once, so the reader
+	 * never sees a part of a message */
+	commit(me, tail + STREAM_HEADER_SIZE + len);
+
+	return err;
+}
+
+os_Error_t Stream_ReadMessage(Stream_t * const me, void * data, size_t size, size_t * len, uint32_t ticks) {
+	os_Error_t err = OS_OK;
+	uint32_t head = me->head;
+	uint16_t header;
+
+	/* Any byte available is the start of a whole message */
+	if(wait(me, 1, ticks) == 0) {
+		* len = 0;
+
+		return OS_FAIL;
+	}
+
+	ringCopyOut(me, head, (uint8_t *)&header, STREAM_HEADER_SIZE);
+	* len = header;
+
+	/* If the message does not fit, then it is kept for a later read */
+	if(header > size) {
+		return OS_FAIL;
+	}
+
+	ringCopyOut(me, head + STREAM_HEADER_SIZE, data, header);
+
+	__DMB();
+	me->head = head + STREAM_HEADER_SIZE + header;
+
+	return err;
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static void ringCopyIn(Stream_t * const me, uint32_t pos, const uint8_t * data, uint32_t len) {
+	uint32_t index = pos & (me->size - 1);
+	uint32_t first = me->size - index;
+
+	/* At most two copies, before and after the end of the storage */
+	if(first > len) {
+		first = len;
+	}
+
+	memcpy(me->buffer + index, data, first);
+	memcpy(me->buffer, data + first, len - first);
+}
+
+static void ringCopyOut(Stream_t * const me, uint32_t pos, uint8_t * data, uint32_t len) {
+	uint32_t index = pos & (me->size - 1);
+	uint32_t first = me->size - index;
+
+	if(first > len) {
+		first = len;
+	}
+
+	memcpy(data, me->buffer + index, first);
+	memcpy(data + first, me->buffer, len - first);
+}
+
+static void commit(Stream_t * const me, uint32_t tail) {
+	uint32_t waiting;
+
+	/* The bytes are written before they are published */
+	__DMB();
+	me->tail = tail;
+	__DMB();
+
+	/* Wake up the reader only when it has enough bytes */
+	waiting = me->waiting;
+
+	if(waiting != 0 && tail - me->head >= waiting) {
+		me->waiting = 0;
+		Semaphore_Give(&me->ready);
+	}
+}
+
+static uint32_t wait(Stream_t * const me, uint32_t bytes, uint32_t ticks) {
+	uint32_t available = me->tail - me->head;
+	uint32_t start;
+	uint32_t now;
+
+	if(available >= bytes || ticks == 0) {
+		return available;
+	}
+
+	os_GetTickCounter(&start);
+
+	for(;;) {
+		/* The level is published before it is checked again, so a write
+		 * in between gives the semaphore and is not lost */
+		me->waiting = bytes;
+		__DMB();
+
+		available = me->tail - me->head;
+
+		if(available >= bytes) {
+			break;
+		}
+
+		if(ticks == MAX_TIME_DELAY) {
+			Semaphore_Take(&me->ready);
+		}
+		else {
+			os_GetTickCounter(&now);
+
+			if(TICKS_DIFF(now, start) >= ticks) {
+				break;
+			}
+
+			Semaphore_TakeTimeout(&me->ready, ticks - TICKS_DIFF(now, start));
+		}
+	}
+
+	me->waiting = 0;
+
+	/* A give after the level was reached would wake up the next wait for
+	 * nothing, it is discarded */
+	Semaphore_TryTake(&me->ready);
+
+	return available;
+}
+
+#endif /* #if OS_USE_STREAMS */
+
+/* end of file ---------------------------------------------------------------*/
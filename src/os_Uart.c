@@ -0,0 +1,149 @@
+/*
+ * os_Uart.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Uart.h"
+
+#if OS_USE_UART
+
+/* macros --------------------------------------------------------------------*/
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+/* external data declaration -------------------------------------------------*/
+
+/* internal functions declaration --------------------------------------------*/
+
+static void startTransfer(Uart_t * const me);
+static void transferDone(void * arg, bool ok);
+
+/* external functions definition ---------------------------------------------*/
+
+os_Error_t Uart_Init(Uart_t * const me, LPC_USART_T * uart, uint32_t peripheral) {
+	os_Error_t err = OS_OK;
+
+	me->uart = uart;
+	me->peripheral = peripheral;
+	me->head = 0;
+	me->tail = 0;
+	me->count = 0;
+	me->busy = false;
+	me->errors = 0;
+
+	Semaphore_Init(&me->done);
+
+	/* The DMA request of the UART is generated by the TX FIFO */
+	Chip_UART_SetupFIFOS(me->uart, UART_FCR_FIFO_EN | UART_FCR_DMAMODE_SEL | UART_FCR_TRG_LEV0);
+
+	err = Dma_Init();
+
+	if(err == OS_OK) {
+		err = Dma_Open(me->peripheral, transferDone, me, &me->channel);
+	}
+
+	return err;
+}
+
+os_Error_t Uart_Write(Uart_t * const me, const void * data, size_t len) {
+	os_Error_t err = OS_OK;
+	const uint8_t * src = (const uint8_t *)data;
+
+	while(len > 0) {
+		os_EnterCritical();
+
+		/* If there is a free buffer, then copy the data and start the
+		 * transfer if the DMA is idle */
+		if(me->count < UART_TX_SLOTS) {
+			size_t chunk = len < UART_TX_SLOT_SIZE ? len : UART_TX_SLOT_SIZE;
+
+			memcpy(me->slots[me->tail].data, src, chunk);
+			me->slots[me->tail].len = chunk;
+			me->tail = (me->tail + 1) % UART_TX_SLOTS;
+			me->count++;
+
+			if(me->busy == false) {
+				startTransfer(me);
+			}
+
+			os_ExitCritical();
+
+			src += chunk;
+			len -= chunk;
+		}
+		/* If all the buffers are in use, then block the task until the
+		 * DMA ends a transfer */
+		else {
+			os_ExitCritical();
+
+			Semaphore_Take(&me->done);
+		}
+	}
+
+	return err;
+}
+
+os_Error_t Uart_WriteString(Uart_t * const me, const char * str) {
+	return Uart_Write(me, str, strlen(str));
+}
+
+os_Error_t Uart_Flush(Uart_t * const me) {
+	os_Error_t err = OS_OK;
+
+	while(me->count > 0) {
+		Semaphore_Take(&me->done);
+	}
+
+	return err;
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static void startTransfer(Uart_t * const me) {
+	me->busy = false;
+
+	/* Start the transfer of the oldest buffer. If the DMA rejects it, then
+	 * the buffer is dropped, so a flush never waits for it */
+	while(me->count > 0 && me->busy == false) {
+		if(Chip_GPDMA_Transfer(LPC_GPDMA, me->channel,
+				(uint32_t)me->slots[me->head].data, me->peripheral,
+				GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA,
+				me->slots[me->head].len) == ERROR) {
+			me->head = (me->head + 1) % UART_TX_SLOTS;
+			me->count--;
+			me->errors++;
+
+			Semaphore_Give(&me->done);
+		}
+		else {
+			me->busy = true;
+		}
+	}
+}
+
+static void transferDone(void * arg, bool ok) {
+	Uart_t * me = (Uart_t *)arg;
+
+	if(ok == false) {
+		me->errors++;
+	}
+
+	/* Release the buffer transmitted and continue with the next one */
+	me->head = (me->head + 1) % UART_TX_SLOTS;
+	me->count--;
+
+	startTransfer(me);
+
+	/* Wake up the task waiting for a free buffer */
+	Semaphore_Give(&me->done);
+}
+
+#endif /* #if OS_USE_UART */
+
+/* end of file ---------------------------------------------------------------*/
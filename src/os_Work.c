@@ -0,0 +1,175 @@
+/*
+ * os_Work.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Work.h"
+
+#if OS_USE_WORK_QUEUES
+
+/* macros --------------------------------------------------------------------*/
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+/* external data declaration -------------------------------------------------*/
+
+/* internal functions declaration --------------------------------------------*/
+
+static void workerTask(void * arg);
+static uint32_t timestamp(void);
+
+/* external functions definition ---------------------------------------------*/
+
+os_Error_t WorkQueue_Init(WorkQueue_t * const me, uint32_t workers, uint32_t priority) {
+	os_Error_t err = OS_OK;
+
+	/* Return with error if the parameters are not valid */
+	if(workers == 0 || workers > WORK_WORKERS_MAX) {
+		return OS_FAIL;
+	}
+
+	memset(me, 0, sizeof(WorkQueue_t));
+
+	for(uint32_t i = 0; i < workers; i++) {
+		WorkQueue_Worker_t * worker = &me->workers[i];
+
+		Semaphore_Init(&worker->wake);
+		worker->queue = me;
+		worker->id = i;
+
+		err = os_CreateTask(workerTask, "Worker", priority, worker);
+
+		if(err != OS_OK) {
+			break;
+		}
+
+		me->workersNum++;
+	}
+
+	return err;
+}
+
+os_Error_t WorkQueue_Submit(WorkQueue_t * const me, WorkQueue_Function_t function, void * arg) {
+	os_Error_t err = OS_OK;
+
+	if(function == NULL) {
+		return OS_FAIL;
+	}
+
+	os_EnterCritical();
+
+	if(me->count < WORK_JOBS_MAX) {
+		WorkQueue_Job_t * job = &me->jobs[(me->head + me->count) % WORK_JOBS_MAX];
+
+		job->function = function;
+		job->arg = arg;
+		job->submitted = timestamp();
+		me->count++;
+		me->submitted++;
+
+		if(me->count > me->backlogMax) {
+			me->backlogMax = me->count;
+		}
+
+		/* Wake up only one idle worker. The busy workers take the job when
+		 * they finish, so a burst of jobs does not wake up all of them */
+		if(me->idleMask != 0) {
+			uint32_t id = __CLZ(__RBIT(me->idleMask));
+
+			me->idleMask &= ~(1U << id);
+			Semaphore_Give(&me->workers[id].wake);
+		}
+	}
+	else {
+		me->dropped++;
+		err = OS_FAIL;
+	}
+
+	os_ExitCritical();
+
+	return err;
+}
+
+os_Error_t WorkQueue_GetStats(WorkQueue_t * const me, WorkQueue_Stats_t * stats) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	stats->submitted = me->submitted;
+	stats->completed = me->completed;
+	stats->dropped = me->dropped;
+	stats->backlog = me->count;
+	stats->backlogMax = me->backlogMax;
+	stats->latencyMax = me->latencyMax;
+	stats->latencyAvg = me->completed > 0 ? (uint32_t)(me->latencySum / me->completed) : 0;
+
+	os_ExitCritical();
+
+	return err;
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static void workerTask(void * arg) {
+	WorkQueue_Worker_t * worker = (WorkQueue_Worker_t *)arg;
+	WorkQueue_t * me = worker->queue;
+
+	for(;;) {
+		WorkQueue_Job_t job;
+		uint32_t latency;
+
+		os_EnterCritical();
+
+		/* If there is no job, then wait as idle. A job submitted between
+		 * the check and the take leaves the semaphore given, so it is not
+		 * lost */
+		if(me->count == 0) {
+			me->idleMask |= 1U << worker->id;
+
+			os_ExitCritical();
+			Semaphore_Take(&worker->wake);
+
+			continue;
+		}
+
+		job = me->jobs[me->head];
+		me->head = (me->head + 1) % WORK_JOBS_MAX;
+		me->count--;
+
+		os_ExitCritical();
+
+		latency = timestamp() - job.submitted;
+
+		job.function(job.arg);
+
+		os_EnterCritical();
+
+		me->completed++;
+		me->latencySum += latency;
+
+		if(latency > me->latencyMax) {
+			me->latencyMax = latency;
+		}
+
+		os_ExitCritical();
+	}
+}
+
+static uint32_t timestamp(void) {
+	uint64_t us;
+
+	/* The lower 32 bits are enough, the differences are wrap-safe */
+	os_GetTimeUs(&us);
+
+	return (uint32_t)us;
+}
+
+#endif /* #if OS_USE_WORK_QUEUES */
+
+/* end of file ---------------------------------------------------------------*/
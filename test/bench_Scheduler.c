@@ -0,0 +1,210 @@
+/*
+ * bench_Scheduler.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include <time.h>
+
+#include "os_Core.h"
+#include "host.h"
+
+/* macros --------------------------------------------------------------------*/
+
+#define ITERATIONS		200000	/**< Operations timed per run */
+#define RUNS			5		/**< Runs per case, the fastest one is reported */
+#define LONG_DELAY		1000000	/**< Delay of the tasks that must not wake up */
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+static const uint32_t tasksCount[] = {8, 16, 32, TASKS_MAX};
+
+/* external data declaration -------------------------------------------------*/
+
+/* Kernel data, global name used by PendSV_Handler.S */
+extern os_t os_Kernel;
+
+/* Tick handler of the kernel */
+void SysTick_Handler(void);
+
+/* internal functions declaration --------------------------------------------*/
+
+static uint64_t timeNs(void);
+static void task(void * arg);
+static void pendSV(void);
+static void start(uint32_t tasks, bool samePriority);
+static void blockAll(uint32_t first, uint32_t step);
+static double benchTickIdle(uint32_t tasks);
+static double benchTickWake(uint32_t tasks);
+static double benchDelay(uint32_t tasks);
+static double benchYield(uint32_t tasks);
+
+/* external functions definition ---------------------------------------------*/
+
+int main(void) {
+	/* The real os_Core.c runs in a single thread: the benchmark plays the
+	 * running task, calls the SysTick handler as the tick and completes a
+	 * pended switch as PendSV_Handler.S does */
+	printf("ns per operation on the host, fastest of %d runs of %d\n", RUNS, ITERATIONS);
+	printf("%6s %12s %12s %12s %12s\n", "tasks", "tick idle", "tick wake", "delay", "yield");
+
+	for(size_t i = 0; i < sizeof(tasksCount) / sizeof(tasksCount[0]); i++) {
+		double (* const benches[])(uint32_t) = {benchTickIdle, benchTickWake, benchDelay, benchYield};
+		double best[4] = {1e9, 1e9, 1e9, 1e9};
+
+		for(uint32_t run = 0; run < RUNS; run++) {
+			for(size_t bench = 0; bench < 4; bench++) {
+				double value = benches[bench](tasksCount[i]);
+
+				best[bench] = value < best[bench] ? value : best[bench];
+			}
+		}
+
+		printf("%6u %12.1f %12.1f %12.1f %12.1f\n", tasksCount[i], best[0], best[1], best[2], best[3]);
+	}
+
+	return 0;
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static uint64_t timeNs(void) {
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static void task(void * arg) {
+}
+
+static void pendSV(void) {
+	/* The context switch: the scheduler already chose taskNext */
+	if(SCB->ICSR & SCB_ICSR_PENDSVSET_Msk) {
+		SCB->ICSR &= ~SCB_ICSR_PENDSVSET_Msk;
+
+		if(os_Kernel.taskNext != os_Kernel.taskCurrent) {
+			os_Kernel.taskCurrent = os_Kernel.taskNext;
+			os_Kernel.contextSwitches++;
+		}
+	}
+}
+
+static void start(uint32_t tasks, bool samePriority) {
+	HOST_CHECK(os_Init() == OS_OK);
+
+	for(uint32_t i = 0; i < tasks; i++) {
+		uint32_t priority = samePriority ? 1 : 1 + i % (PRIORITY_RESERVED - 1);
+
+		HOST_CHECK(os_CreateTask(task, "task", priority, NULL) == OS_OK);
+	}
+
+	HOST_CHECK(os_StartScheduler() == OS_OK);
+
+	/* First tick, the highest priority task takes the CPU */
+	SysTick_Handler();
+	pendSV();
+}
+
+static void blockAll(uint32_t first, uint32_t step) {
+	uint32_t ticks = first;
+
+	/* Each task blocks in turn until the idle task runs */
+	while(os_Kernel.taskCurrent != &os_Kernel.tasksArray[IDLE_TASK_ID]) {
+		HOST_CHECK(os_TaskDelay(ticks) == OS_OK);
+		pendSV();
+		ticks += step;
+	}
+}
+
+static double benchTickIdle(uint32_t tasks) {
+	uint64_t begin;
+
+	/* All the tasks blocked with timeouts far away: the tick only checks
+	 * the head of the timeouts list */
+	start(tasks, false);
+	blockAll(LONG_DELAY, 1);
+
+	begin = timeNs();
+
+	for(uint32_t i = 0; i < ITERATIONS; i++) {
+		SysTick_Handler();
+		pendSV();
+	}
+
+	return (timeNs() - begin) / (double)ITERATIONS;
+}
+
+static double benchTickWake(uint32_t tasks) {
+	uint64_t elapsed = 0;
+	uint32_t rounds = ITERATIONS / tasks;
+
+	/* The tasks block for 1, 2... tasks ticks, so each tick wakes one up
+	 * and switches to it if it has a higher priority. Only the ticks are
+	 * timed */
+	for(uint32_t round = 0; round < rounds; round++) {
+		uint64_t begin;
+
+		start(tasks, false);
+		blockAll(1, 1);
+
+		begin = timeNs();
+
+		for(uint32_t i = 0; i < tasks; i++) {
+			SysTick_Handler();
+			pendSV();
+		}
+
+		elapsed += timeNs() - begin;
+
+		HOST_CHECK(os_Kernel.timerHead == TASK_NONE);
+	}
+
+	return elapsed / (double)(rounds * tasks);
+}
+
+static double benchDelay(uint32_t tasks) {
+	uint64_t elapsed = 0;
+	uint32_t rounds = ITERATIONS / tasks;
+
+	/* Each task blocks with a timeout later than all the others, the worst
+	 * case of the insertion in the sorted timeouts list */
+	for(uint32_t round = 0; round < rounds; round++) {
+		uint64_t begin;
+
+		start(tasks, false);
+
+		begin = timeNs();
+		blockAll(1, 1);
+		elapsed += timeNs() - begin;
+	}
+
+	return elapsed / (double)(rounds * tasks);
+}
+
+static double benchYield(uint32_t tasks) {
+	uint64_t begin;
+
+	/* All the tasks ready with the same priority, each yield goes to the
+	 * next one */
+	start(tasks, true);
+
+	begin = timeNs();
+
+	for(uint32_t i = 0; i < ITERATIONS; i++) {
+		os_Yield();
+		pendSV();
+	}
+
+	HOST_CHECK(os_Kernel.contextSwitches >= ITERATIONS);
+
+	return (timeNs() - begin) / (double)ITERATIONS;
+}
+
+/* end of file ---------------------------------------------------------------*/
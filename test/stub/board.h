@@ -0,0 +1,257 @@
+/*
+ * board.h
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+#ifndef _BOARD_H_
+#define _BOARD_H_
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* macros --------------------------------------------------------------------*/
+
+/* Host stand-in of the CMSIS, LPCOpen and board headers used by the kernel
+ * and its drivers. The registers are plain variables and the peripherals
+ * the drivers use are simulated by chip.c */
+
+#define __NVIC_PRIO_BITS				3
+
+#define SCB_ICSR_PENDSVSET_Msk			(1UL << 28)
+#define SCB_ICSR_PENDSTSET_Msk			(1UL << 26)
+#define SCB_ICSR_VECTACTIVE_Msk			0x1FFUL
+#define SysTick_CTRL_COUNTFLAG_Msk		(1UL << 16)
+#define DWT_CTRL_CYCCNTENA_Msk			1UL
+#define CoreDebug_DEMCR_TRCENA_Msk		(1UL << 24)
+#define FPU_FPCCR_ASPEN_Msk				(1UL << 31)
+#define FPU_FPCCR_LSPEN_Msk				(1UL << 30)
+
+/* GPDMA */
+#define GPDMA_NUMBER_CHANNELS			8
+#define GPDMA_CONN_UART0_Tx				1
+#define GPDMA_CONN_UART0_Rx				2
+#define GPDMA_CONN_UART2_Tx				3
+#define GPDMA_CONN_UART2_Rx				4
+#define GPDMA_CONN_ADC_0				5
+#define GPDMA_CONN_ADC_1				6
+#define GPDMA_CONN_SCT_0				7
+#define GPDMA_DMACCxControl_I			(1UL << 31)
+
+/* UART */
+#define UART_FCR_FIFO_EN				(1 << 0)
+#define UART_FCR_DMAMODE_SEL			(1 << 3)
+#define UART_FCR_TRG_LEV0				(0)
+
+/* Pin interrupts */
+#define PININTCH(ch)					(1 << (ch))
+
+#ifdef CORE_M0
+#define M0_M4CORE_IRQn					((LPC43XX_IRQn_Type)1)
+#endif
+
+/* typedef -------------------------------------------------------------------*/
+
+typedef enum {
+	NonMaskableInt_IRQn = -14,
+	PendSV_IRQn = -2,
+	SysTick_IRQn = -1,
+	DAC_IRQn = 0,
+	M0APP_IRQn,
+	DMA_IRQn,
+	RESERVED1_IRQn,
+	RESERVED2_IRQn,
+	ETHERNET_IRQn,
+	SDIO_IRQn,
+	LCD_IRQn,
+	USB0_IRQn,
+	USB1_IRQn,
+	SCT_IRQn,
+	RITIMER_IRQn,
+	TIMER0_IRQn,
+	TIMER1_IRQn,
+	TIMER2_IRQn,
+	TIMER3_IRQn,
+	MCPWM_IRQn,
+	ADC0_IRQn,
+	I2C0_IRQn,
+	I2C1_IRQn,
+	SPI_INT_IRQn,
+	ADC1_IRQn,
+	SSP0_IRQn,
+	SSP1_IRQn,
+	USART0_IRQn,
+	UART1_IRQn,
+	USART2_IRQn,
+	USART3_IRQn,
+	I2S0_IRQn,
+	I2S1_IRQn,
+	RESERVED4_IRQn,
+	SGPIO_INT_IRQn,
+	PIN_INT0_IRQn,
+	PIN_INT1_IRQn,
+	PIN_INT2_IRQn,
+	PIN_INT3_IRQn,
+	PIN_INT4_IRQn,
+	PIN_INT5_IRQn,
+	PIN_INT6_IRQn,
+	PIN_INT7_IRQn,
+	GINT0_IRQn,
+	GINT1_IRQn,
+	EVENTROUTER_IRQn,
+	C_CAN1_IRQn,
+	RESERVED6_IRQn,
+	ADCHS_IRQn,
+	ATIMER_IRQn,
+	RTC_IRQn,
+	RESERVED8_IRQn,
+	WWDT_IRQn,
+	M0SUB_IRQn,
+	C_CAN0_IRQn,
+	QEI_IRQn
+} LPC43XX_IRQn_Type;
+
+typedef LPC43XX_IRQn_Type IRQn_Type;
+
+typedef enum {
+	ERROR = 0,
+	SUCCESS = !ERROR
+} Status;
+
+typedef struct {
+	volatile uint32_t CPUID, ICSR, VTOR, AIRCR, SCR, CCR;
+	volatile uint8_t SHP[12];
+	volatile uint32_t SHCSR, CFSR, HFSR, DFSR, MMFAR, BFAR, AFSR;
+	volatile uint32_t CPACR;
+} SCB_Type;
+
+typedef struct {
+	volatile uint32_t CTRL, LOAD, VAL, CALIB;
+} SysTick_Type;
+
+typedef struct {
+	volatile uint32_t CTRL, CYCCNT;
+} DWT_Type;
+
+typedef struct {
+	volatile uint32_t DHCSR, DCRSR, DCRDR, DEMCR;
+} CoreDebug_Type;
+
+typedef struct {
+	volatile uint32_t FPCCR, FPCAR, FPDSCR;
+} FPU_Type;
+
+typedef struct {
+	volatile uint32_t INTSTAT;	/**< Channels with a terminal count or error interrupt */
+} LPC_GPDMA_T;
+
+typedef enum {
+	GPDMA_TRANSFERTYPE_M2M_CONTROLLER_DMA = 0,
+	GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA,
+	GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA,
+	GPDMA_TRANSFERTYPE_P2P_CONTROLLER_DMA
+} GPDMA_FLOW_CONTROL_T;
+
+typedef struct {
+	uint32_t src;	/**< Source address or peripheral connection */
+	uint32_t dst;	/**< Destination address or peripheral connection */
+	uint32_t lli;	/**< Next descriptor, 0 for the last one */
+	uint32_t ctrl;	/**< Transfer size and interrupt enable */
+} DMA_TransferDescriptor_t;
+
+typedef struct {
+	volatile uint32_t FCR;
+} LPC_USART_T;
+
+typedef struct {
+	volatile uint32_t IST;
+} LPC_PIN_INT_T;
+
+typedef LPC_PIN_INT_T LPC_GPIOPININT_T;
+
+typedef struct {
+	volatile uint32_t M4TXEVENT, M0APPTXEVENT, M0APPMEMMAP;
+} LPC_CREG_T;
+
+typedef enum {
+	RGU_M0APP_RST = 56
+} CHIP_RGU_RST_T;
+
+/* external data declaration -------------------------------------------------*/
+
+extern SCB_Type * SCB;
+extern SysTick_Type * SysTick;
+extern DWT_Type * DWT;
+extern CoreDebug_Type * CoreDebug;
+extern FPU_Type * FPU;
+extern LPC_GPDMA_T * LPC_GPDMA;
+extern LPC_USART_T * LPC_USART0;
+extern LPC_USART_T * LPC_USART2;
+extern LPC_GPIOPININT_T * LPC_GPIO_PIN_INT;
+extern LPC_CREG_T * LPC_CREG;
+extern uint32_t SystemCoreClock;
+
+/* external functions declaration --------------------------------------------*/
+
+/* CMSIS */
+void SystemCoreClockUpdate(void);
+uint32_t SysTick_Config(uint32_t ticks);
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority);
+void NVIC_EnableIRQ(IRQn_Type irq);
+void NVIC_DisableIRQ(IRQn_Type irq);
+void NVIC_ClearPendingIRQ(IRQn_Type irq);
+void NVIC_SetPendingIRQ(IRQn_Type irq);
+void __disable_irq(void);
+void __enable_irq(void);
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t primask);
+uint32_t __get_IPSR(void);
+void __set_PSP(uint32_t psp);
+uint32_t __get_PSP(void);
+void __ISB(void);
+void __DSB(void);
+void __DMB(void);
+void __WFI(void);
+void __WFE(void);
+void __SEV(void);
+uint8_t __CLZ(uint32_t value);
+uint32_t __RBIT(uint32_t value);
+
+/* LPCOpen */
+void Board_Init(void);
+void Chip_GPDMA_Init(LPC_GPDMA_T * pGPDMA);
+uint8_t Chip_GPDMA_GetFreeChannel(LPC_GPDMA_T * pGPDMA, uint32_t PeripheralConnection_ID);
+Status Chip_GPDMA_Transfer(LPC_GPDMA_T * pGPDMA, uint8_t ChannelNum, uint32_t src, uint32_t dst, GPDMA_FLOW_CONTROL_T TransferType, uint32_t Size);
+Status Chip_GPDMA_InitDescriptor(LPC_GPDMA_T * pGPDMA, DMA_TransferDescriptor_t * DMADescriptor, uint32_t src, uint32_t dst, uint32_t Size, GPDMA_FLOW_CONTROL_T TransferType, const DMA_TransferDescriptor_t * NextDescriptor);
+Status Chip_GPDMA_SGTransfer(LPC_GPDMA_T * pGPDMA, uint8_t ChannelNum, const DMA_TransferDescriptor_t * DMADescriptor, GPDMA_FLOW_CONTROL_T TransferType);
+Status Chip_GPDMA_Interrupt(LPC_GPDMA_T * pGPDMA, uint8_t ch);
+void Chip_GPDMA_Stop(LPC_GPDMA_T * pGPDMA, uint8_t ChannelNum);
+void Chip_UART_SetupFIFOS(LPC_USART_T * pUART, uint32_t fcr);
+void Chip_SCU_GPIOIntPinSel(uint8_t PortSel, uint8_t PortNum, uint8_t PinNum);
+void Chip_PININT_ClearIntStatus(LPC_PIN_INT_T * pPININT, uint32_t pins);
+void Chip_PININT_SetPinModeEdge(LPC_PIN_INT_T * pPININT, uint32_t pins);
+void Chip_PININT_EnableIntLow(LPC_PIN_INT_T * pPININT, uint32_t pins);
+void Chip_PININT_EnableIntHigh(LPC_PIN_INT_T * pPININT, uint32_t pins);
+void Chip_RGU_TriggerReset(CHIP_RGU_RST_T ResetNumber);
+void Chip_RGU_ClearReset(CHIP_RGU_RST_T ResetNumber);
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef _BOARD_H_ */
+
+/* end of file ---------------------------------------------------------------*/
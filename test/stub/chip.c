@@ -0,0 +1,595 @@
+/*
+ * chip.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#include "host.h"
+
+/* macros --------------------------------------------------------------------*/
+
+#define DMA_PERIOD_DEFAULT	2		/**< Default time to move an element in us */
+#define DMA_SIZE_MAX		0xFFF	/**< Max elements of a transfer, the size field of the control word */
+#define IRQ_MAX				64		/**< Interrupts the simulated NVIC handles */
+
+/* typedef -------------------------------------------------------------------*/
+
+/* Simulated GPDMA channel */
+typedef struct {
+	bool claimed;					/**< Given by Chip_GPDMA_GetFreeChannel() */
+	bool enabled;					/**< Transfer in progress */
+	GPDMA_FLOW_CONTROL_T type;		/**< Flow of the transfer */
+	uint32_t src;					/**< Source address or connection */
+	uint32_t dst;					/**< Destination address or connection */
+	uint32_t size;					/**< Elements of the current descriptor */
+	uint32_t done;					/**< Elements moved of the current descriptor */
+	uint32_t lli;					/**< Next descriptor, loaded when the current one ends */
+} dmaChannel_t;
+
+/* internal data declaration -------------------------------------------------*/
+
+static SCB_Type scb;
+static SysTick_Type sysTick;
+static DWT_Type dwt;
+static CoreDebug_Type coreDebug;
+static FPU_Type fpu;
+static LPC_GPDMA_T gpdma;
+static LPC_USART_T usart0;
+static LPC_USART_T usart2;
+static LPC_GPIOPININT_T pinInt;
+static LPC_CREG_T creg;
+static uint32_t primask;
+
+/* Simulated GPDMA */
+static pthread_mutex_t dmaLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t dmaOnce = PTHREAD_ONCE_INIT;
+static dmaChannel_t dmaChannels[GPDMA_NUMBER_CHANNELS];
+static uint32_t dmaPeriod = DMA_PERIOD_DEFAULT;
+static uint32_t dmaSamples;
+static uint8_t uartCapture[HOST_UART_CAPTURE];
+static size_t uartLen;
+
+/* Simulated NVIC */
+static pthread_mutex_t irqLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t irqRaised = PTHREAD_COND_INITIALIZER;
+static pthread_once_t irqOnce = PTHREAD_ONCE_INIT;
+static uint64_t irqPending;
+
+/* Event of the Cortex-M0APP, set by a __SEV() of the M4 */
+static pthread_mutex_t eventLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t eventSent = PTHREAD_COND_INITIALIZER;
+static bool eventM0;
+static __thread Host_Core_e core = HOST_CORE_M4;
+
+/* external data declaration -------------------------------------------------*/
+
+SCB_Type * SCB = &scb;
+SysTick_Type * SysTick = &sysTick;
+DWT_Type * DWT = &dwt;
+CoreDebug_Type * CoreDebug = &coreDebug;
+FPU_Type * FPU = &fpu;
+LPC_GPDMA_T * LPC_GPDMA = &gpdma;
+LPC_USART_T * LPC_USART0 = &usart0;
+LPC_USART_T * LPC_USART2 = &usart2;
+LPC_GPIOPININT_T * LPC_GPIO_PIN_INT = &pinInt;
+LPC_CREG_T * LPC_CREG = &creg;
+uint32_t SystemCoreClock = 204000000;
+
+/* internal functions declaration --------------------------------------------*/
+
+static void dmaStart(void);
+static void * dmaThread(void * arg);
+static void dmaStep(uint8_t ch);
+static void irqStart(void);
+static void * irqThread(void * arg);
+static void * address(uint32_t value);
+static void pendSV(void);
+
+/* external functions definition ---------------------------------------------*/
+
+void Host_DmaSetPeriod(uint32_t us) {
+	pthread_mutex_lock(&dmaLock);
+	dmaPeriod = us > 0 ? us : 1;
+	pthread_mutex_unlock(&dmaLock);
+}
+
+size_t Host_UartOutput(uint8_t * data) {
+	size_t len;
+
+	pthread_mutex_lock(&dmaLock);
+
+	len = uartLen;
+
+	if(data != NULL) {
+		memcpy(data, uartCapture, len);
+	}
+
+	pthread_mutex_unlock(&dmaLock);
+
+	return len;
+}
+
+uint32_t Host_DmaSamples(void) {
+	uint32_t samples;
+
+	pthread_mutex_lock(&dmaLock);
+	samples = dmaSamples;
+	pthread_mutex_unlock(&dmaLock);
+
+	return samples;
+}
+
+void Host_RaiseIRQ(LPC43XX_IRQn_Type irq) {
+	pthread_once(&irqOnce, irqStart);
+
+	pthread_mutex_lock(&irqLock);
+	irqPending |= 1ULL << irq;
+	pthread_cond_signal(&irqRaised);
+	pthread_mutex_unlock(&irqLock);
+}
+
+void __attribute__((weak)) Host_Vector(LPC43XX_IRQn_Type irq) {
+	(void)irq;
+}
+
+void __attribute__((weak)) Host_PendSV(void) {
+}
+
+void Host_SetCore(Host_Core_e value) {
+	core = value;
+}
+
+uint64_t Host_TimeUs(void) {
+	static uint64_t start;
+	struct timespec now;
+	uint64_t us;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	us = (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+
+	if(start == 0) {
+		start = us;
+	}
+
+	return us - start;
+}
+
+/* CMSIS */
+void SystemCoreClockUpdate(void) {
+}
+
+uint32_t SysTick_Config(uint32_t ticks) {
+	SysTick->LOAD = ticks - 1;
+	SysTick->VAL = 0;
+
+	return 0;
+}
+
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority) {
+	(void)irq;
+	(void)priority;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq) {
+	(void)irq;
+}
+
+void NVIC_DisableIRQ(IRQn_Type irq) {
+	(void)irq;
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type irq) {
+	pthread_mutex_lock(&irqLock);
+	irqPending &= ~(1ULL << irq);
+	pthread_mutex_unlock(&irqLock);
+}
+
+void NVIC_SetPendingIRQ(IRQn_Type irq) {
+	Host_RaiseIRQ(irq);
+}
+
+void __disable_irq(void) {
+	primask = 1;
+}
+
+void __enable_irq(void) {
+	primask = 0;
+	pendSV();
+}
+
+uint32_t __get_PRIMASK(void) {
+	return primask;
+}
+
+void __set_PRIMASK(uint32_t value) {
+	primask = value;
+
+	if(primask == 0) {
+		pendSV();
+	}
+}
+
+uint32_t __get_IPSR(void) {
+	return 0;
+}
+
+void __set_PSP(uint32_t psp) {
+	(void)psp;
+}
+
+uint32_t __get_PSP(void) {
+	return 0;
+}
+
+void __ISB(void) {
+	__sync_synchronize();
+}
+
+void __DSB(void) {
+	__sync_synchronize();
+}
+
+void __DMB(void) {
+	__sync_synchronize();
+}
+
+void __WFI(void) {
+	struct timespec timeout;
+
+	/* The M4 idles by giving the CPU to the other threads. The M0 sleeps
+	 * until the M4 sends an event, the wait is bounded so a test never
+	 * hangs on a lost event, it would fail on its checks instead */
+	if(core == HOST_CORE_M4) {
+		sched_yield();
+		return;
+	}
+
+	clock_gettime(CLOCK_REALTIME, &timeout);
+	timeout.tv_nsec += 1000000;
+
+	if(timeout.tv_nsec >= 1000000000) {
+		timeout.tv_sec++;
+		timeout.tv_nsec -= 1000000000;
+	}
+
+	pthread_mutex_lock(&eventLock);
+
+	while(eventM0 == false) {
+		if(pthread_cond_timedwait(&eventSent, &eventLock, &timeout) != 0) {
+			break;
+		}
+	}
+
+	eventM0 = false;
+
+	pthread_mutex_unlock(&eventLock);
+}
+
+void __WFE(void) {
+	__WFI();
+}
+
+void __SEV(void) {
+	/* The event of the M0 is the M0APP interrupt of the M4, the event of
+	 * the M4 wakes the M0 up */
+	if(core == HOST_CORE_M0) {
+		Host_RaiseIRQ(M0APP_IRQn);
+		return;
+	}
+
+	pthread_mutex_lock(&eventLock);
+	eventM0 = true;
+	pthread_cond_signal(&eventSent);
+	pthread_mutex_unlock(&eventLock);
+}
+
+uint8_t __CLZ(uint32_t value) {
+	return value != 0 ? __builtin_clz(value) : 32;
+}
+
+uint32_t __RBIT(uint32_t value) {
+	uint32_t result = 0;
+
+	for(uint32_t i = 0; i < 32; i++) {
+		result = (result << 1) | (value & 1);
+		value >>= 1;
+	}
+
+	return result;
+}
+
+/* LPCOpen */
+void Board_Init(void) {
+}
+
+void Chip_GPDMA_Init(LPC_GPDMA_T * pGPDMA) {
+	(void)pGPDMA;
+
+	pthread_once(&dmaOnce, dmaStart);
+}
+
+uint8_t Chip_GPDMA_GetFreeChannel(LPC_GPDMA_T * pGPDMA, uint32_t PeripheralConnection_ID) {
+	uint8_t ch = 0;
+
+	(void)pGPDMA;
+	(void)PeripheralConnection_ID;
+
+	pthread_mutex_lock(&dmaLock);
+
+	/* As the chip library, the channel 0 is returned when all are busy */
+	for(uint8_t i = 0; i < GPDMA_NUMBER_CHANNELS; i++) {
+		if(dmaChannels[i].claimed == false && dmaChannels[i].enabled == false) {
+			dmaChannels[i].claimed = true;
+			ch = i;
+			break;
+		}
+	}
+
+	pthread_mutex_unlock(&dmaLock);
+
+	return ch;
+}
+
+Status Chip_GPDMA_Transfer(LPC_GPDMA_T * pGPDMA, uint8_t ChannelNum, uint32_t src, uint32_t dst, GPDMA_FLOW_CONTROL_T TransferType, uint32_t Size) {
+	DMA_TransferDescriptor_t descriptor;
+
+	if(Chip_GPDMA_InitDescriptor(pGPDMA, &descriptor, src, dst, Size, TransferType, NULL) == ERROR) {
+		return ERROR;
+	}
+
+	return Chip_GPDMA_SGTransfer(pGPDMA, ChannelNum, &descriptor, TransferType);
+}
+
+Status Chip_GPDMA_InitDescriptor(LPC_GPDMA_T * pGPDMA, DMA_TransferDescriptor_t * DMADescriptor, uint32_t src, uint32_t dst, uint32_t Size, GPDMA_FLOW_CONTROL_T TransferType, const DMA_TransferDescriptor_t * NextDescriptor) {
+	(void)pGPDMA;
+	(void)TransferType;
+
+	if(Size == 0 || Size > DMA_SIZE_MAX) {
+		return ERROR;
+	}
+
+	/* The descriptors are read by the DMA as 32-bit addresses */
+	DMADescriptor->src = src;
+	DMADescriptor->dst = dst;
+	DMADescriptor->lli = (uint32_t)(uintptr_t)NextDescriptor;
+	DMADescriptor->ctrl = Size | GPDMA_DMACCxControl_I;
+
+	return SUCCESS;
+}
+
+Status Chip_GPDMA_SGTransfer(LPC_GPDMA_T * pGPDMA, uint8_t ChannelNum, const DMA_TransferDescriptor_t * DMADescriptor, GPDMA_FLOW_CONTROL_T TransferType) {
+	Status status = SUCCESS;
+	dmaChannel_t * channel;
+
+	(void)pGPDMA;
+
+	if(ChannelNum >= GPDMA_NUMBER_CHANNELS) {
+		return ERROR;
+	}
+
+	channel = &dmaChannels[ChannelNum];
+
+	pthread_mutex_lock(&dmaLock);
+
+	/* A channel is programmed only while it is disabled */
+	if(channel->enabled == true) {
+		status = ERROR;
+	}
+	else {
+		channel->type = TransferType;
+		channel->src = DMADescriptor->src;
+		channel->dst = DMADescriptor->dst;
+		channel->size = DMADescriptor->ctrl & DMA_SIZE_MAX;
+		channel->lli = DMADescriptor->lli;
+		channel->done = 0;
+		channel->enabled = true;
+	}
+
+	pthread_mutex_unlock(&dmaLock);
+
+	return status;
+}
+
+Status Chip_GPDMA_Interrupt(LPC_GPDMA_T * pGPDMA, uint8_t ch) {
+	uint32_t mask = 1UL << ch;
+
+	/* Clear the terminal count flag of the channel */
+	if((__atomic_fetch_and(&pGPDMA->INTSTAT, ~mask, __ATOMIC_SEQ_CST) & mask) != 0) {
+		return SUCCESS;
+	}
+
+	return ERROR;
+}
+
+void Chip_GPDMA_Stop(LPC_GPDMA_T * pGPDMA, uint8_t ChannelNum) {
+	pthread_mutex_lock(&dmaLock);
+
+	dmaChannels[ChannelNum].enabled = false;
+	dmaChannels[ChannelNum].claimed = false;
+	__atomic_fetch_and(&pGPDMA->INTSTAT, ~(1UL << ChannelNum), __ATOMIC_SEQ_CST);
+
+	pthread_mutex_unlock(&dmaLock);
+}
+
+void Chip_UART_SetupFIFOS(LPC_USART_T * pUART, uint32_t fcr) {
+	pUART->FCR = fcr;
+}
+
+void Chip_SCU_GPIOIntPinSel(uint8_t PortSel, uint8_t PortNum, uint8_t PinNum) {
+	(void)PortSel;
+	(void)PortNum;
+	(void)PinNum;
+}
+
+void Chip_PININT_ClearIntStatus(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+	pPININT->IST &= ~pins;
+}
+
+void Chip_PININT_SetPinModeEdge(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+	(void)pPININT;
+	(void)pins;
+}
+
+void Chip_PININT_EnableIntLow(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+	(void)pPININT;
+	(void)pins;
+}
+
+void Chip_PININT_EnableIntHigh(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+	(void)pPININT;
+	(void)pins;
+}
+
+void Chip_RGU_TriggerReset(CHIP_RGU_RST_T ResetNumber) {
+	(void)ResetNumber;
+}
+
+void Chip_RGU_ClearReset(CHIP_RGU_RST_T ResetNumber) {
+	(void)ResetNumber;
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static void dmaStart(void) {
+	pthread_t thread;
+
+	pthread_create(&thread, NULL, dmaThread, NULL);
+	pthread_detach(thread);
+}
+
+static void * dmaThread(void * arg) {
+	uint64_t last = Host_TimeUs();
+
+	(void)arg;
+
+	/* The elements due since the last pass are moved in one burst, so the
+	 * transfer rate does not depend on the sleep resolution. The DMA goes
+	 * on with the next descriptor while the interrupt is pending, as the
+	 * hardware does, but it does not end that descriptor before the
+	 * interrupt is served: a late host thread must not merge two terminal
+	 * counts, which the target avoids with an interrupt latency shorter
+	 * than a transfer */
+	for(;;) {
+		struct timespec pause = {0, 20000};
+		uint64_t now;
+		uint64_t due;
+
+		nanosleep(&pause, NULL);
+
+		pthread_mutex_lock(&dmaLock);
+
+		now = Host_TimeUs();
+		due = (now - last) / dmaPeriod;
+		last += due * dmaPeriod;
+
+		for(uint64_t i = 0; i < due; i++) {
+			for(uint8_t ch = 0; ch < GPDMA_NUMBER_CHANNELS; ch++) {
+				dmaChannel_t * channel = &dmaChannels[ch];
+
+				if(channel->enabled == true && (channel->done + 1 < channel->size || (LPC_GPDMA->INTSTAT & (1UL << ch)) == 0)) {
+					dmaStep(ch);
+				}
+			}
+		}
+
+		pthread_mutex_unlock(&dmaLock);
+	}
+
+	return NULL;
+}
+
+static void dmaStep(uint8_t ch) {
+	dmaChannel_t * channel = &dmaChannels[ch];
+
+	/* Memory to UART moves bytes, peripheral to memory moves the words of
+	 * a simulated sampling peripheral */
+	if(channel->type == GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA) {
+		uint8_t byte = ((uint8_t *)address(channel->src))[channel->done];
+
+		if(uartLen < HOST_UART_CAPTURE) {
+			uartCapture[uartLen++] = byte;
+		}
+	}
+	else if(channel->type == GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA) {
+		((volatile uint32_t *)address(channel->dst))[channel->done] = dmaSamples++;
+	}
+
+	channel->done++;
+
+	if(channel->done < channel->size) {
+		return;
+	}
+
+	/* Terminal count: the next descriptor is loaded from memory right away
+	 * and the interrupt is served later */
+	__atomic_fetch_or(&LPC_GPDMA->INTSTAT, 1UL << ch, __ATOMIC_SEQ_CST);
+
+	if(channel->lli != 0) {
+		const DMA_TransferDescriptor_t * next = (const DMA_TransferDescriptor_t *)address(channel->lli);
+
+		channel->src = next->src;
+		channel->dst = next->dst;
+		channel->size = next->ctrl & DMA_SIZE_MAX;
+		channel->lli = next->lli;
+		channel->done = 0;
+	}
+	else {
+		channel->enabled = false;
+	}
+
+	Host_RaiseIRQ(DMA_IRQn);
+}
+
+static void irqStart(void) {
+	pthread_t thread;
+
+	pthread_create(&thread, NULL, irqThread, NULL);
+	pthread_detach(thread);
+}
+
+static void * irqThread(void * arg) {
+	(void)arg;
+
+	/* Serve the pending interrupts, lowest number first */
+	for(;;) {
+		LPC43XX_IRQn_Type irq;
+
+		pthread_mutex_lock(&irqLock);
+
+		while(irqPending == 0) {
+			pthread_cond_wait(&irqRaised, &irqLock);
+		}
+
+		irq = (LPC43XX_IRQn_Type)__builtin_ctzll(irqPending);
+		irqPending &= ~(1ULL << irq);
+
+		pthread_mutex_unlock(&irqLock);
+
+		Host_Vector(irq);
+	}
+
+	return NULL;
+}
+
+static void pendSV(void) {
+	/* A switch pended with the interrupts masked is taken once they are
+	 * unmasked */
+	if(SCB->ICSR & SCB_ICSR_PENDSVSET_Msk) {
+		Host_PendSV();
+	}
+}
+
+static void * address(uint32_t value) {
+	/* The programs are linked at low addresses, the static buffers given
+	 * to the DMA fit in 32 bits */
+	return (void *)(uintptr_t)value;
+}
+
+/* end of file ---------------------------------------------------------------*/
@@ -0,0 +1,113 @@
+/*
+ * host.h
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+#ifndef _HOST_H_
+#define _HOST_H_
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "board.h"
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* macros --------------------------------------------------------------------*/
+
+#define HOST_UART_CAPTURE	65536	/**< Bytes kept of the simulated UART output */
+
+/* Test assertion, it reports the failed condition and ends the program */
+#define HOST_CHECK(cond)	do { \
+		if(!(cond)) { \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			exit(1); \
+		} \
+	} while(0)
+
+/* typedef -------------------------------------------------------------------*/
+
+/**
+ * @brief Simulated cores, each thread runs on one of them.
+ */
+typedef enum {
+	HOST_CORE_M4 = 0,	/**< Cortex-M4, the default */
+	HOST_CORE_M0		/**< Cortex-M0APP */
+} Host_Core_e;
+
+/* external data declaration -------------------------------------------------*/
+
+/* external functions declaration --------------------------------------------*/
+
+/**
+ * @brief Set the time the simulated GPDMA takes to move each element.
+ * @param us
+ */
+void Host_DmaSetPeriod(uint32_t us);
+
+/**
+ * @brief Read the bytes written so far by the DMA to the simulated UARTs.
+ * @param data NULL to only get the length
+ * @return number of bytes
+ */
+size_t Host_UartOutput(uint8_t * data);
+
+/**
+ * @brief Number of elements moved so far by the DMA from the simulated
+ * 		  peripherals to memory. The peripherals produce the sequence
+ * 		  0, 1, 2...
+ * @return number of samples
+ */
+uint32_t Host_DmaSamples(void);
+
+/**
+ * @brief Raise an interrupt. It is served by the interrupt thread, out of
+ * 		  the critical sections of the kernel stand-in.
+ * @param irq
+ */
+void Host_RaiseIRQ(LPC43XX_IRQn_Type irq);
+
+/**
+ * @brief Serve an interrupt raised with Host_RaiseIRQ(), it is provided by
+ * 		  the kernel linked with the test.
+ * @param irq
+ */
+void Host_Vector(LPC43XX_IRQn_Type irq);
+
+/**
+ * @brief Take a pended context switch, called when the interrupts are
+ * 		  unmasked. It is provided by the port linked with the test, by
+ * 		  default the switch is left pending.
+ */
+void Host_PendSV(void);
+
+/**
+ * @brief Set the core of the calling thread, __SEV() and __WFI() signal
+ * 		  the other core.
+ * @param core
+ */
+void Host_SetCore(Host_Core_e core);
+
+/**
+ * @brief Monotonic time.
+ * @return microseconds since the first call
+ */
+uint64_t Host_TimeUs(void);
+
+/* cplusplus -----------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef _HOST_H_ */
+
+/* end of file ---------------------------------------------------------------*/
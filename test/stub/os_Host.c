@@ -0,0 +1,234 @@
+/*
+ * os_Host.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <errno.h>
+
+#include "os_Core.h"
+#include "host.h"
+
+/* macros --------------------------------------------------------------------*/
+
+/* Host stand-in of the kernel for the tests of the drivers: the tasks are
+ * threads, a critical section holds one lock shared with the interrupt
+ * thread and the semaphores wait on a condition variable. The drivers are
+ * compiled from src/ unchanged */
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+/* Lock of the critical sections, the interrupts are served holding it */
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Signaled on each give */
+static pthread_cond_t given = PTHREAD_COND_INITIALIZER;
+
+/* Critical sections nesting of each thread */
+static __thread uint32_t criticalCounter;
+
+/* ISR handlers array */
+static ISR_t isrHandler[IRQ_NUM];
+
+/* external data declaration -------------------------------------------------*/
+
+/* internal functions declaration --------------------------------------------*/
+
+static void deadline(struct timespec * time, uint32_t ticks);
+
+/* external functions definition ---------------------------------------------*/
+
+os_Error_t os_Yield(void) {
+	os_Error_t err = OS_OK;
+
+	if(criticalCounter == 0) {
+		sched_yield();
+	}
+
+	return err;
+}
+
+os_Error_t os_EnterCritical(void) {
+	os_Error_t err = OS_OK;
+
+	if(criticalCounter++ == 0) {
+		pthread_mutex_lock(&lock);
+	}
+
+	return err;
+}
+
+os_Error_t os_ExitCritical(void) {
+	os_Error_t err = OS_OK;
+
+	if(criticalCounter > 0 && --criticalCounter == 0) {
+		pthread_mutex_unlock(&lock);
+	}
+
+	return err;
+}
+
+os_Error_t os_InstallIRQ(LPC43XX_IRQn_Type irq, void * isr, void * arg) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	if(irq < 0 || irq >= IRQ_NUM || isrHandler[irq].handler != NULL) {
+		err = OS_FAIL;
+	}
+	else {
+		isrHandler[irq].handler = isr;
+		isrHandler[irq].arg = arg;
+	}
+
+	os_ExitCritical();
+
+	return err;
+}
+
+os_Error_t os_UninstallIRQ(LPC43XX_IRQn_Type irq) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	isrHandler[irq].handler = NULL;
+	isrHandler[irq].arg = NULL;
+
+	os_ExitCritical();
+
+	return err;
+}
+
+os_Error_t os_TaskDelay(uint32_t ticks) {
+	os_Error_t err = OS_OK;
+	struct timespec delay;
+
+	delay.tv_sec = ((uint64_t)ticks * SYSTICK_TIME) / 1000000;
+	delay.tv_nsec = (((uint64_t)ticks * SYSTICK_TIME) % 1000000) * 1000;
+
+	nanosleep(&delay, NULL);
+
+	return err;
+}
+
+os_Error_t os_GetTickCounter(uint32_t * ticks) {
+	os_Error_t err = OS_OK;
+
+	* ticks = (uint32_t)(Host_TimeUs() / SYSTICK_TIME);
+
+	return err;
+}
+
+os_Error_t Semaphore_Init(Semaphore_t * const me) {
+	os_Error_t err = OS_OK;
+
+	me->task = NULL;
+	me->isGiven = false;
+	me->set = NULL;
+
+	return err;
+}
+
+os_Error_t Semaphore_Take(Semaphore_t * const me) {
+	return Semaphore_TakeTimeout(me, MAX_TIME_DELAY);
+}
+
+os_Error_t Semaphore_TakeTimeout(Semaphore_t * const me, uint32_t ticks) {
+	os_Error_t err = OS_OK;
+	struct timespec time;
+
+	deadline(&time, ticks);
+
+	os_EnterCritical();
+
+	while(me->isGiven == false && ticks > 0) {
+		/* The wait releases the lock, so it must not be nested in a
+		 * critical section, as a blocking call of the kernel */
+		HOST_CHECK(criticalCounter == 1);
+
+		if(ticks == MAX_TIME_DELAY) {
+			pthread_cond_wait(&given, &lock);
+		}
+		else if(pthread_cond_timedwait(&given, &lock, &time) == ETIMEDOUT) {
+			break;
+		}
+	}
+
+	if(me->isGiven == true) {
+		me->isGiven = false;
+	}
+	else {
+		err = OS_FAIL;
+	}
+
+	os_ExitCritical();
+
+	return err;
+}
+
+os_Error_t Semaphore_TryTake(Semaphore_t * const me) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	if(me->isGiven == true) {
+		me->isGiven = false;
+	}
+	else {
+		err = OS_FAIL;
+	}
+
+	os_ExitCritical();
+
+	return err;
+}
+
+os_Error_t Semaphore_Give(Semaphore_t * const me) {
+	os_Error_t err = OS_OK;
+
+	os_EnterCritical();
+
+	me->isGiven = true;
+	pthread_cond_broadcast(&given);
+
+	os_ExitCritical();
+
+	return err;
+}
+
+void Host_Vector(LPC43XX_IRQn_Type irq) {
+	/* An interrupt can not preempt a critical section */
+	os_EnterCritical();
+
+	if(irq >= 0 && irq < IRQ_NUM && isrHandler[irq].handler != NULL) {
+		isrHandler[irq].handler(isrHandler[irq].arg);
+	}
+
+	os_ExitCritical();
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static void deadline(struct timespec * time, uint32_t ticks) {
+	uint64_t us = (uint64_t)ticks * SYSTICK_TIME;
+
+	clock_gettime(CLOCK_REALTIME, time);
+
+	time->tv_sec += us / 1000000;
+	time->tv_nsec += (us % 1000000) * 1000;
+
+	if(time->tv_nsec >= 1000000000) {
+		time->tv_sec++;
+		time->tv_nsec -= 1000000000;
+	}
+}
+
+/* end of file ---------------------------------------------------------------*/
@@ -0,0 +1,108 @@
+/*
+ * os_Port.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include <pthread.h>
+
+#include "os_Core.h"
+#include "host.h"
+
+/* macros --------------------------------------------------------------------*/
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+/* The task that owns the CPU, only its thread runs */
+static pthread_mutex_t batonLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t batonPassed = PTHREAD_COND_INITIALIZER;
+static os_Task_t * baton;
+static bool started[TASKS_MAX + 1];
+static __thread os_Task_t * self;
+
+/* external data declaration -------------------------------------------------*/
+
+/* Kernel data, global name used by PendSV_Handler.S */
+extern os_t os_Kernel;
+
+/* internal functions declaration --------------------------------------------*/
+
+static void * taskThread(void * arg);
+static void batonWait(os_Task_t * task);
+
+/* external functions definition ---------------------------------------------*/
+
+void Host_PendSV(void) {
+	os_Task_t * current;
+	os_Task_t * next;
+
+	/* The port of the real os_Core.c: each task runs in its own thread and
+	 * a context switch passes the baton from the thread of taskCurrent to
+	 * the one of taskNext, as PendSV_Handler.S swaps the stacks */
+	SCB->ICSR &= ~SCB_ICSR_PENDSVSET_Msk;
+
+	current = os_Kernel.taskCurrent;
+	next = os_Kernel.taskNext;
+
+	if(next == current) {
+		return;
+	}
+
+	os_Kernel.taskCurrent = next;
+	os_Kernel.contextSwitches++;
+
+	/* The first switch comes from main(), the reset task */
+	if(self == NULL) {
+		self = current;
+	}
+
+	pthread_mutex_lock(&batonLock);
+
+	baton = next;
+
+	if(started[next->id] == false) {
+		pthread_t thread;
+
+		started[next->id] = true;
+		HOST_CHECK(pthread_create(&thread, NULL, taskThread, next) == 0);
+	}
+
+	pthread_cond_broadcast(&batonPassed);
+	pthread_mutex_unlock(&batonLock);
+
+	batonWait(self);
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static void * taskThread(void * arg) {
+	os_Task_t * task = arg;
+	os_TaskInfo_t * info = &os_Kernel.tasksInfo[task->id];
+
+	self = task;
+	batonWait(task);
+
+	/* The task starts as from the frame built by initTask() */
+	((void (*)(void *))info->entryPoint)((void *)(uintptr_t)info->stack[info->stackSize - R0_REG_POS]);
+
+	HOST_CHECK(false);
+
+	return NULL;
+}
+
+static void batonWait(os_Task_t * task) {
+	pthread_mutex_lock(&batonLock);
+
+	while(baton != task) {
+		pthread_cond_wait(&batonPassed, &batonLock);
+	}
+
+	pthread_mutex_unlock(&batonLock);
+}
+
+/* end of file ---------------------------------------------------------------*/
@@ -0,0 +1,135 @@
+/*
+ * test_Acquire.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include <time.h>
+
+#include "os_Acquire.h"
+#include "host.h"
+
+/* macros --------------------------------------------------------------------*/
+
+#define BUFFERS		4		/**< Buffers of the acquisition */
+#define SAMPLES		1000	/**< Samples per buffer */
+#define SAMPLE_US	5		/**< Time of a sample, a buffer takes 5 ms */
+#define GETS		100		/**< Buffers taken by the fast task */
+#define GET_TICKS	100		/**< Timeout to get a buffer */
+#define HOLD_US		50000	/**< Time the slow task holds its buffers, many buffers long */
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+static Acquire_t acquire;
+static uint32_t storage[BUFFERS * SAMPLES];
+static uint32_t copies[BUFFERS][SAMPLES];
+
+/* external data declaration -------------------------------------------------*/
+
+/* internal functions declaration --------------------------------------------*/
+
+static void checkBuffer(const uint32_t * buffer);
+static void testFast(void);
+static void testHeld(void);
+
+/* external functions definition ---------------------------------------------*/
+
+int main(void) {
+	/* The simulated peripheral produces 0, 1, 2... and the simulated GPDMA
+	 * follows the descriptors chain as the hardware does. The buffers are
+	 * long enough for the interrupt thread to serve each one in time */
+	Host_DmaSetPeriod(SAMPLE_US);
+	HOST_CHECK(Acquire_Init(&acquire, GPDMA_CONN_ADC_0, storage, 2, SAMPLES) == OS_FAIL);
+	HOST_CHECK(Acquire_Init(&acquire, GPDMA_CONN_ADC_0, storage, BUFFERS, ACQUIRE_SAMPLES_MAX + 1) == OS_FAIL);
+	HOST_CHECK(Acquire_Init(&acquire, GPDMA_CONN_ADC_0, storage, BUFFERS, SAMPLES) == OS_OK);
+	HOST_CHECK(Acquire_Start(&acquire) == OS_OK);
+
+	testFast();
+	testHeld();
+
+	HOST_CHECK(Acquire_Stop(&acquire) == OS_OK);
+	HOST_CHECK(acquire.errors == 0);
+
+	printf("%u overruns\n", acquire.overruns);
+	printf("test_Acquire: ok\n");
+
+	return 0;
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static void checkBuffer(const uint32_t * buffer) {
+	/* A buffer is filled by one transfer, its samples are consecutive */
+	for(uint32_t i = 1; i < SAMPLES; i++) {
+		HOST_CHECK(buffer[i] == buffer[0] + i);
+	}
+}
+
+static void testFast(void) {
+	uint32_t * buffer;
+	uint32_t last = 0;
+	uint32_t overruns = 0;
+	uint32_t contiguous = 0;
+
+	/* The DMA goes from one buffer to the next by itself: without overruns
+	 * the first sample of a buffer follows the last one of the previous */
+	for(uint32_t i = 0; i < GETS; i++) {
+		HOST_CHECK(Acquire_Get(&acquire, &buffer, GET_TICKS) == OS_OK);
+		checkBuffer(buffer);
+
+		if(i > 0 && acquire.overruns == overruns) {
+			HOST_CHECK(buffer[0] == last + 1);
+			contiguous++;
+		}
+
+		last = buffer[SAMPLES - 1];
+		overruns = acquire.overruns;
+
+		HOST_CHECK(Acquire_Release(&acquire) == OS_OK);
+	}
+
+	HOST_CHECK(contiguous > 0);
+	HOST_CHECK(Acquire_Release(&acquire) == OS_FAIL);
+}
+
+static void testHeld(void) {
+	struct timespec hold = {0, HOLD_US * 1000};
+	uint32_t * buffers[BUFFERS];
+	uint32_t overruns;
+	uint32_t held = 0;
+
+	/* The task takes all the buffers it can, the DMA keeps the one it is
+	 * filling */
+	while(Acquire_Get(&acquire, &buffers[held], GET_TICKS) == OS_OK) {
+		HOST_CHECK(held < BUFFERS - 1);
+		checkBuffer(buffers[held]);
+		memcpy(copies[held], buffers[held], sizeof(copies[held]));
+		held++;
+	}
+
+	HOST_CHECK(held == BUFFERS - 1);
+
+	/* The DMA keeps filling its own buffers, never the held ones */
+	overruns = acquire.overruns;
+	nanosleep(&hold, NULL);
+	HOST_CHECK(acquire.overruns > overruns);
+
+	for(uint32_t i = 0; i < held; i++) {
+		HOST_CHECK(memcmp(copies[i], buffers[i], sizeof(copies[i])) == 0);
+		HOST_CHECK(Acquire_Release(&acquire) == OS_OK);
+	}
+
+	/* The chain goes on once the buffers are released */
+	for(uint32_t i = 0; i < BUFFERS; i++) {
+		HOST_CHECK(Acquire_Get(&acquire, &buffers[0], GET_TICKS) == OS_OK);
+		checkBuffer(buffers[0]);
+		HOST_CHECK(Acquire_Release(&acquire) == OS_OK);
+	}
+}
+
+/* end of file ---------------------------------------------------------------*/
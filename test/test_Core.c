@@ -0,0 +1,203 @@
+/*
+ * test_Core.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Core.h"
+#include "host.h"
+
+/* macros --------------------------------------------------------------------*/
+
+#define TICKS_MAX	100		/**< Ticks a scenario may take before it is considered hung */
+#define QUEUE_LEN	(QUEUE_SIZE_BYTES / sizeof(uint64_t))	/**< Elements of the test queue */
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+static Semaphore_t semaphore;
+static Semaphore_t wakeup;
+static Queue_t queue;
+static uint32_t waiterA;
+static uint32_t waiterB;
+static uint32_t waiterD;
+static volatile bool failedA;
+static volatile bool takenB;
+static volatile bool receivedB;
+static volatile uint32_t runsD;
+
+/* external data declaration -------------------------------------------------*/
+
+/* Tick handler of the kernel */
+void SysTick_Handler(void);
+
+/* internal functions declaration --------------------------------------------*/
+
+static void testQueue(void);
+static void taskA(void * arg);
+static void taskB(void * arg);
+static void taskC(void * arg);
+static void taskD(void * arg);
+
+/* external functions definition ---------------------------------------------*/
+
+int main(void) {
+	/* The real os_Core.c on the port of stub/os_Port.c: each task is a
+	 * thread, the idle task drives the ticks */
+	HOST_CHECK(os_Init() == OS_OK);
+	testQueue();
+	HOST_CHECK(Semaphore_Init(&semaphore) == OS_OK);
+	HOST_CHECK(Semaphore_Init(&wakeup) == OS_OK);
+	HOST_CHECK(os_CreateTask(taskA, "A", 2, NULL) == OS_OK);
+	HOST_CHECK(os_CreateTask(taskB, "B", 1, NULL) == OS_OK);
+	HOST_CHECK(os_CreateTask(taskC, "C", 3, NULL) == OS_OK);
+	HOST_CHECK(os_CreateTask(taskD, "D", 4, NULL) == OS_OK);
+	HOST_CHECK(os_StartScheduler() == OS_OK);
+
+	/* The first tick switches to the tasks, main() never runs again */
+	SysTick_Handler();
+
+	HOST_CHECK(false);
+
+	return 1;
+}
+
+void idleTask(void) {
+	for(uint32_t ticks = 0; ticks < TICKS_MAX; ticks++) {
+		HOST_CHECK(os_UpdatePostMortem() == OS_OK);
+		SysTick_Handler();
+	}
+
+	HOST_CHECK(false);
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static void testQueue(void) {
+	uint64_t data[QUEUE_LEN];
+	size_t n;
+
+	HOST_CHECK(Queue_Init(&queue, 0) == OS_FAIL);
+	HOST_CHECK(Queue_Init(&queue, QUEUE_SIZE_BYTES + 1) == OS_FAIL);
+	HOST_CHECK(Queue_Init(&queue, sizeof(uint64_t)) == OS_OK);
+	HOST_CHECK(queue.len == QUEUE_LEN);
+
+	for(size_t i = 0; i < QUEUE_LEN; i++) {
+		data[i] = i;
+	}
+
+	/* Full, then the head moves past the first two elements */
+	HOST_CHECK(Queue_SendMany(&queue, data, QUEUE_LEN, &n) == OS_OK && n == QUEUE_LEN);
+	HOST_CHECK(Queue_Send(&queue, &data[0]) == OS_FAIL);
+	HOST_CHECK(Queue_ReceiveMany(&queue, data, QUEUE_LEN, 2, &n, 0) == OS_OK && n == QUEUE_LEN);
+	HOST_CHECK(Queue_SendMany(&queue, data, QUEUE_LEN, &n) == OS_OK && n == QUEUE_LEN);
+	HOST_CHECK(Queue_ReceiveMany(&queue, data, 2, 2, &n, 0) == OS_OK && n == 2);
+	HOST_CHECK(data[0] == 0 && data[1] == 1);
+
+	/* A wait for more elements than the ring holds is rejected */
+	HOST_CHECK(Queue_ReceiveMany(&queue, data, QUEUE_LEN + 1, QUEUE_LEN + 1, &n, 0) == OS_FAIL);
+
+	/* The ring is left with head at 2 and QUEUE_LEN - 2 elements, taskB
+	 * waits for all of them */
+}
+
+static void taskA(void * arg) {
+	HOST_CHECK(os_GetTaskId(&waiterA) == OS_OK);
+
+	/* Suspended and resumed while blocked, the take fails */
+	failedA = Semaphore_Take(&semaphore) == OS_FAIL;
+
+	for(;;) {
+		os_TaskDelay(MAX_TIME_DELAY);
+	}
+}
+
+static void taskB(void * arg) {
+	uint64_t data[QUEUE_LEN];
+	size_t n;
+
+	HOST_CHECK(os_GetTaskId(&waiterB) == OS_OK);
+
+	/* Blocks on the semaphore once A was suspended */
+	os_TaskDelay(2);
+	takenB = Semaphore_Take(&semaphore) == OS_OK;
+
+	/* The sends wrap around the end of the ring, a full queue is reached
+	 * wherever its head is */
+	receivedB = Queue_ReceiveMany(&queue, data, QUEUE_LEN, QUEUE_LEN, &n, MAX_TIME_DELAY) == OS_OK;
+
+	for(size_t i = 0; i < QUEUE_LEN; i++) {
+		HOST_CHECK(data[i] == i + 2);
+	}
+
+	for(;;) {
+		os_TaskDelay(MAX_TIME_DELAY);
+	}
+}
+
+static void taskC(void * arg) {
+	uint64_t data[] = {QUEUE_LEN, QUEUE_LEN + 1};
+
+	/* Tick 1: A is blocked on the semaphore */
+	os_TaskDelay(1);
+	HOST_CHECK(os_SuspendTask(waiterA) == OS_OK);
+
+	/* Tick 3: B is blocked on the semaphore, A runs again and must not
+	 * release the waiter of B */
+	os_TaskDelay(2);
+	HOST_CHECK(os_ResumeTask(waiterA) == OS_OK);
+	os_TaskDelay(1);
+	HOST_CHECK(failedA == true);
+
+	/* Tick 4: the give wakes B up */
+	HOST_CHECK(Semaphore_Give(&semaphore) == OS_OK);
+	os_TaskDelay(1);
+	HOST_CHECK(takenB == true);
+
+	/* Tick 5: B waits for a full queue, it is woken up by the last send */
+	HOST_CHECK(receivedB == false);
+	HOST_CHECK(Queue_Send(&queue, &data[0]) == OS_OK);
+	HOST_CHECK(Queue_Send(&queue, &data[1]) == OS_OK);
+	os_TaskDelay(1);
+	HOST_CHECK(receivedB == true && queue.count == 0);
+
+	/* Tick 6: D is readied in a critical section, the switch to it is
+	 * pending when it is suspended and it must not run */
+	os_EnterCritical();
+	HOST_CHECK(Semaphore_Give(&wakeup) == OS_OK);
+	HOST_CHECK(os_SuspendTask(waiterD) == OS_OK);
+	os_ExitCritical();
+	HOST_CHECK(runsD == 0);
+
+	/* Resumed, D takes the semaphore and blocks again */
+	HOST_CHECK(os_ResumeTask(waiterD) == OS_OK);
+	HOST_CHECK(runsD == 1);
+
+	/* The same with a deletion, the pending switch does not go to the
+	 * deleted slot */
+	os_EnterCritical();
+	HOST_CHECK(Semaphore_Give(&wakeup) == OS_OK);
+	HOST_CHECK(os_DeleteTask(waiterD) == OS_OK);
+	os_ExitCritical();
+	HOST_CHECK(runsD == 1);
+	HOST_CHECK(os_ResumeTask(waiterD) == OS_FAIL);
+
+	printf("test_Core: ok\n");
+	exit(0);
+}
+
+static void taskD(void * arg) {
+	HOST_CHECK(os_GetTaskId(&waiterD) == OS_OK);
+
+	/* The highest priority, it runs as soon as it is readied */
+	for(;;) {
+		HOST_CHECK(Semaphore_Take(&wakeup) == OS_OK);
+		runsD++;
+	}
+}
+
+/* end of file ---------------------------------------------------------------*/
@@ -0,0 +1,167 @@
+/*
+ * test_Cpp.cpp
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os.hpp"
+#include "host.h"
+
+/* macros --------------------------------------------------------------------*/
+
+#define POOL_SIZE	3	/**< Blocks of the pool */
+
+/* typedef -------------------------------------------------------------------*/
+
+typedef struct {
+	uint16_t channel;
+	uint32_t value;
+} sample_t;
+
+class Counter {
+public:
+	explicit Counter(uint32_t start) : value(start) { instances++; }
+	~Counter() { instances--; }
+
+	uint32_t value;
+	static uint32_t instances;
+};
+
+uint32_t Counter::instances = 0;
+
+/* internal data declaration -------------------------------------------------*/
+
+/* One instance of each template, built against the C kernel */
+static os::Queue<sample_t, 4> samples;
+static os::Queue<uint8_t, QUEUE_SIZE_BYTES> bytes;
+static os::Task<1024> integerTask;
+static os::Task<2048, true> fpuTask;
+static os::Pool<Counter, POOL_SIZE> pool;
+
+/* external data declaration -------------------------------------------------*/
+
+/* internal functions declaration --------------------------------------------*/
+
+static void task(void * arg);
+static void testQueue(void);
+static void testQueueMany(void);
+static void testTask(void);
+static void testPool(void);
+
+/* external functions definition ---------------------------------------------*/
+
+int main(void) {
+	testQueue();
+	testQueueMany();
+	testTask();
+	testPool();
+
+	printf("test_Cpp: ok\n");
+
+	return 0;
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static void task(void * arg) {
+	(void)arg;
+}
+
+static void testQueue(void) {
+	sample_t sample;
+	QueueSet_t set;
+	void * member = nullptr;
+
+	/* The storage is sized by N, not by QUEUE_SIZE_BYTES */
+	static_assert(decltype(samples)::capacity() == 4, "capacity");
+	static_assert(sizeof(samples) < sizeof(Queue_t), "storage");
+
+	for(uint16_t i = 0; i < 4; i++) {
+		HOST_CHECK(samples.send(sample_t{i, 100u + i}));
+	}
+
+	HOST_CHECK(!samples.send(sample_t{4, 104}));
+	HOST_CHECK(samples.size() == 4);
+
+	/* The queue is a member of a set through its semaphore, ready exactly
+	 * while it has elements */
+	HOST_CHECK(QueueSet_Init(&set) == OS_OK);
+	HOST_CHECK(QueueSet_AddSemaphore(&set, samples.handle()) == OS_OK);
+	HOST_CHECK(QueueSet_Select(&set, &member, 0) == OS_OK);
+	HOST_CHECK(member == samples.handle());
+
+	for(uint16_t i = 0; i < 4; i++) {
+		HOST_CHECK(samples.receive(sample, 0));
+		HOST_CHECK(sample.channel == i && sample.value == 100u + i);
+	}
+
+	HOST_CHECK(!samples.receive(sample, 0));
+	HOST_CHECK(QueueSet_Select(&set, &member, 0) == OS_FAIL);
+	HOST_CHECK(QueueSet_Remove(&set, samples.handle()) == OS_OK);
+}
+
+static void testQueueMany(void) {
+	uint8_t data[QUEUE_SIZE_BYTES + 8];
+	uint8_t read[QUEUE_SIZE_BYTES];
+
+	for(size_t i = 0; i < sizeof(data); i++) {
+		data[i] = (uint8_t)i;
+	}
+
+	/* A batch is cut at the capacity */
+	HOST_CHECK(bytes.send(data, sizeof(data)) == QUEUE_SIZE_BYTES);
+	HOST_CHECK(bytes.receive(read, sizeof(read), sizeof(read), 0) == QUEUE_SIZE_BYTES);
+	HOST_CHECK(memcmp(read, data, sizeof(read)) == 0);
+	HOST_CHECK(bytes.receive(read, sizeof(read), 1, 0) == 0);
+
+	/* The ring wraps around its end */
+	HOST_CHECK(bytes.send(data, 8) == 8);
+	HOST_CHECK(bytes.receive(read, 8, 8, 0) == 8);
+	HOST_CHECK(bytes.send(data, sizeof(read)) == QUEUE_SIZE_BYTES);
+	HOST_CHECK(bytes.receive(read, sizeof(read), sizeof(read), 0) == QUEUE_SIZE_BYTES);
+	HOST_CHECK(memcmp(read, data, sizeof(read)) == 0);
+}
+
+static void testTask(void) {
+	static_assert(decltype(fpuTask)::stackSize() == 2048, "stack size");
+
+	HOST_CHECK(os_Init() == OS_OK);
+
+	/* The highest priority is only given once, by its own function */
+	HOST_CHECK(integerTask.create(task, "integer", PRIORITY_RESERVED) == OS_FAIL);
+	HOST_CHECK(fpuTask.create(task, "fpu", PRIORITY_RESERVED) == OS_FAIL);
+	HOST_CHECK(os_CreateTask(reinterpret_cast<void *>(task), "task", PRIORITY_RESERVED, nullptr) == OS_FAIL);
+	HOST_CHECK(os_CreateTaskReserved(reinterpret_cast<void *>(task), "reserved", nullptr) == OS_OK);
+	HOST_CHECK(os_CreateTaskReserved(reinterpret_cast<void *>(task), "reserved", nullptr) == OS_FAIL);
+
+	HOST_CHECK(integerTask.create(task, "integer", 1) == OS_OK);
+	HOST_CHECK(fpuTask.create(task, "fpu", 2) == OS_OK);
+}
+
+static void testPool(void) {
+	Counter * counters[POOL_SIZE];
+
+	for(size_t i = 0; i < POOL_SIZE; i++) {
+		counters[i] = pool.allocate(static_cast<uint32_t>(i));
+		HOST_CHECK(counters[i] != nullptr && counters[i]->value == i);
+	}
+
+	HOST_CHECK(pool.allocate(0u) == nullptr);
+	HOST_CHECK(pool.size() == POOL_SIZE && Counter::instances == POOL_SIZE);
+
+	/* A block given back is taken by the next allocation */
+	pool.free(counters[1]);
+	HOST_CHECK(Counter::instances == POOL_SIZE - 1);
+	HOST_CHECK(pool.allocate(7u) == counters[1]);
+
+	for(size_t i = 0; i < POOL_SIZE; i++) {
+		pool.free(counters[i]);
+	}
+
+	HOST_CHECK(pool.size() == 0 && Counter::instances == 0);
+}
+
+/* end of file ---------------------------------------------------------------*/
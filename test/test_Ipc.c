@@ -0,0 +1,109 @@
+/*
+ * test_Ipc.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include <pthread.h>
+
+#include "os_Ipc.h"
+#include "host.h"
+
+/* macros --------------------------------------------------------------------*/
+
+#define CALLERS		4		/**< M4 tasks calling the M0 at the same time */
+#define CALLS		2000	/**< Calls of each task, the rings wrap many times */
+#define CALL_TICKS	1000	/**< Timeout of a call */
+#define START_TICKS	1000	/**< Timeout of the start of the M0 */
+#define BOOT_US		20000	/**< Time the M0 takes to start serving */
+#define COMMAND_ADD	1		/**< Adds 1 to the argument */
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+/* Image of the M0, only its alignment is checked */
+static uint8_t image[4096] __attribute__((aligned(4096)));
+
+/* external data declaration -------------------------------------------------*/
+
+/* Dispatcher of the M0 side, built from os_Ipc.c with CORE_M0 */
+void Ipc_Serve(Ipc_Handler_t handler);
+
+/* internal functions declaration --------------------------------------------*/
+
+static uint32_t handler(uint32_t command, uint32_t arg);
+static void * m0Thread(void * arg);
+static void * callerThread(void * arg);
+
+/* external functions definition ---------------------------------------------*/
+
+int main(void) {
+	pthread_t m0;
+	pthread_t callers[CALLERS];
+	uint32_t result;
+
+	/* The M4 side runs on the kernel stand-in, the M0 side is a thread of
+	 * its own: the rings and the doorbells are used as on the two cores */
+	HOST_CHECK(Ipc_Init() == OS_OK);
+
+	/* Nothing serves the calls before the M0 starts */
+	HOST_CHECK(Ipc_Call(COMMAND_ADD, 1, &result, CALL_TICKS) == OS_FAIL);
+	HOST_CHECK(Ipc_StartM0(image + 1, START_TICKS) == OS_FAIL);
+	HOST_CHECK(Ipc_StartM0(image, 10) == OS_FAIL);
+
+	/* The start waits for the dispatcher */
+	HOST_CHECK(pthread_create(&m0, NULL, m0Thread, NULL) == 0);
+	HOST_CHECK(Ipc_StartM0(image, START_TICKS) == OS_OK);
+	HOST_CHECK(Ipc_Call(COMMAND_ADD, 1, &result, CALL_TICKS) == OS_OK && result == 2);
+
+	for(uintptr_t i = 0; i < CALLERS; i++) {
+		HOST_CHECK(pthread_create(&callers[i], NULL, callerThread, (void *)i) == 0);
+	}
+
+	for(uint32_t i = 0; i < CALLERS; i++) {
+		pthread_join(callers[i], NULL);
+	}
+
+	printf("%u calls from %u tasks\n", CALLS * CALLERS, CALLERS);
+	printf("test_Ipc: ok\n");
+
+	return 0;
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static uint32_t handler(uint32_t command, uint32_t arg) {
+	HOST_CHECK(command == COMMAND_ADD);
+
+	return arg + 1;
+}
+
+static void * m0Thread(void * arg) {
+	struct timespec boot = {0, BOOT_US * 1000};
+
+	Host_SetCore(HOST_CORE_M0);
+	nanosleep(&boot, NULL);
+
+	Ipc_Serve(handler);
+
+	return NULL;
+}
+
+static void * callerThread(void * arg) {
+	uint32_t base = (uintptr_t)arg * CALLS;
+	uint32_t result;
+
+	/* Each response matches its own call */
+	for(uint32_t i = 0; i < CALLS; i++) {
+		HOST_CHECK(Ipc_Call(COMMAND_ADD, base + i, &result, CALL_TICKS) == OS_OK);
+		HOST_CHECK(result == base + i + 1);
+	}
+
+	return NULL;
+}
+
+/* end of file ---------------------------------------------------------------*/
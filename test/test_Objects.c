@@ -0,0 +1,77 @@
+/*
+ * test_Objects.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Core.h"
+#include "host.h"
+
+/* macros --------------------------------------------------------------------*/
+
+#define GARBAGE		0xA5	/**< Content of the memory before the objects are initialized */
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+static Semaphore_t semaphore;
+static Queue_t queue;
+
+/* external data declaration -------------------------------------------------*/
+
+/* internal functions declaration --------------------------------------------*/
+
+static uint32_t objectsCount(void);
+
+/* external functions definition ---------------------------------------------*/
+
+int main(void) {
+	/* The registry of os_Core.c built with OBJECT_STATS, the objects are
+	 * initialized before the scheduler starts */
+	HOST_CHECK(os_Init() == OS_OK);
+	HOST_CHECK(objectsCount() == 0);
+
+	/* The memory of an object not registered yet is not read */
+	memset(&semaphore, GARBAGE, sizeof(semaphore));
+	memset(&queue, GARBAGE, sizeof(queue));
+	HOST_CHECK(Semaphore_Init(&semaphore) == OS_OK);
+	HOST_CHECK(Queue_Init(&queue, sizeof(uint32_t)) == OS_OK);
+	HOST_CHECK(objectsCount() == 2);
+
+	/* Initialized again, the object is registered once and its statistics
+	 * start over */
+	HOST_CHECK(Semaphore_Give(&semaphore) == OS_OK);
+	HOST_CHECK(os_SetObjectName(&semaphore.object, "semaphore") == OS_OK);
+	HOST_CHECK(Semaphore_Init(&semaphore) == OS_OK);
+	HOST_CHECK(objectsCount() == 2);
+	HOST_CHECK(semaphore.object.name == NULL && semaphore.object.stats.sends == 0);
+	HOST_CHECK(semaphore.object.type == OBJECT_SEMAPHORE);
+
+	/* Removed, the rest of the registry is kept */
+	HOST_CHECK(os_RemoveObject(&semaphore.object) == OS_OK);
+	HOST_CHECK(os_RemoveObject(&semaphore.object) == OS_FAIL);
+	HOST_CHECK(objectsCount() == 1 && os_GetNextObject(NULL) == &queue.object);
+
+	printf("test_Objects: ok\n");
+
+	return 0;
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static uint32_t objectsCount(void) {
+	uint32_t count = 0;
+
+	for(os_Object_t * object = os_GetNextObject(NULL); object != NULL; object = os_GetNextObject(object)) {
+		HOST_CHECK(count < 2);
+		count++;
+	}
+
+	return count;
+}
+
+/* end of file ---------------------------------------------------------------*/
@@ -0,0 +1,150 @@
+/*
+ * test_SeqLock.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "os_SeqLock.h"
+#include "host.h"
+
+/* macros --------------------------------------------------------------------*/
+
+#define WRITES		2000000	/**< Writes of the shared data */
+#define READERS		2		/**< Reader threads */
+#define WORDS		32		/**< Words of the shared data, all written with the same value */
+
+/* typedef -------------------------------------------------------------------*/
+
+typedef struct {
+	uint32_t words[WORDS];
+} shared_t;
+
+typedef struct {
+	bool preempted;		/**< The copy is preempted halfway, as a task by the ISR */
+	uint32_t reads;		/**< Consistent copies read */
+	uint32_t retries;	/**< Copies read again because of a write */
+} reader_t;
+
+/* internal data declaration -------------------------------------------------*/
+
+static SeqLock_t lock;
+static shared_t shared;
+static volatile bool done;
+
+/* external data declaration -------------------------------------------------*/
+
+/* internal functions declaration --------------------------------------------*/
+
+static void * writer(void * arg);
+static void * reader(void * arg);
+
+/* external functions definition ---------------------------------------------*/
+
+int main(void) {
+	pthread_t writerThread;
+	pthread_t readerThreads[READERS];
+	reader_t readers[READERS] = {0};
+
+	/* The writer plays the ISR and the readers the tasks. Each write fills
+	 * all the words with the same value, so a read that mixes two writes
+	 * is a torn read. One reader gives the CPU to the writer in the middle
+	 * of each copy, so the retries are exercised even on a single CPU */
+	HOST_CHECK(SeqLock_Init(&lock) == OS_OK);
+
+	readers[1].preempted = true;
+
+	for(uint32_t i = 0; i < READERS; i++) {
+		HOST_CHECK(pthread_create(&readerThreads[i], NULL, reader, &readers[i]) == 0);
+	}
+
+	HOST_CHECK(pthread_create(&writerThread, NULL, writer, NULL) == 0);
+	pthread_join(writerThread, NULL);
+
+	for(uint32_t i = 0; i < READERS; i++) {
+		pthread_join(readerThreads[i], NULL);
+		HOST_CHECK(readers[i].reads > 0);
+	}
+
+	HOST_CHECK(readers[1].retries > 0);
+
+	HOST_CHECK((lock.sequence & 1) == 0 && lock.sequence == 2 * WRITES);
+
+	printf("%u writes", WRITES);
+
+	for(uint32_t i = 0; i < READERS; i++) {
+		printf(", reader %u: %u reads %u retries", i, readers[i].reads, readers[i].retries);
+	}
+
+	printf("\ntest_SeqLock: ok\n");
+
+	return 0;
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static void * writer(void * arg) {
+	shared_t value;
+
+	for(uint32_t i = 1; i <= WRITES; i++) {
+		for(uint32_t j = 0; j < WORDS; j++) {
+			value.words[j] = i;
+		}
+
+		SeqLock_Write(&lock, &shared, &value, sizeof(shared_t));
+	}
+
+	done = true;
+
+	return NULL;
+}
+
+static void * reader(void * arg) {
+	reader_t * me = arg;
+	uint32_t last = 0;
+	uint32_t sequence;
+	shared_t copy;
+
+	/* One more read once the writer is done, it must see the last write */
+	for(bool finished = false; finished == false; ) {
+		finished = done;
+
+		if(me->preempted == false) {
+			SeqLock_Read(&lock, &copy, &shared, sizeof(shared_t));
+		}
+		else {
+			for(;;) {
+				sequence = SeqLock_ReadBegin(&lock);
+				memcpy(copy.words, shared.words, sizeof(shared_t) / 2);
+				sched_yield();
+				memcpy(copy.words + WORDS / 2, shared.words + WORDS / 2, sizeof(shared_t) / 2);
+
+				if(SeqLock_ReadRetry(&lock, sequence) == false) {
+					break;
+				}
+
+				me->retries++;
+			}
+		}
+
+		for(uint32_t j = 1; j < WORDS; j++) {
+			HOST_CHECK(copy.words[j] == copy.words[0]);
+		}
+
+		/* A single writer: the values never go back */
+		HOST_CHECK(copy.words[0] >= last);
+		last = copy.words[0];
+		me->reads++;
+	}
+
+	HOST_CHECK(last == WRITES);
+
+	return NULL;
+}
+
+/* end of file ---------------------------------------------------------------*/
@@ -0,0 +1,110 @@
+/*
+ * test_Uart.c
+ *
+ * Created on: Oct 19, 2026
+ * Author: Mauricio Barroso Benavides
+ */
+
+/* inclusions ----------------------------------------------------------------*/
+
+#include "os_Uart.h"
+#include "host.h"
+
+/* macros --------------------------------------------------------------------*/
+
+#define STREAM_BYTES	6000	/**< Bytes written by the stream test */
+#define BYTE_TIME		10		/**< Simulated UART time per byte in us */
+
+/* typedef -------------------------------------------------------------------*/
+
+/* internal data declaration -------------------------------------------------*/
+
+/* The DMA reads the slots as 32-bit addresses, so the driver is static */
+static Uart_t uart;
+static uint8_t stream[STREAM_BYTES];
+static uint8_t output[HOST_UART_CAPTURE];
+
+/* external data declaration -------------------------------------------------*/
+
+/* internal functions declaration --------------------------------------------*/
+
+static void testWriteReturns(void);
+static void testStream(void);
+
+/* external functions definition ---------------------------------------------*/
+
+int main(void) {
+	Host_DmaSetPeriod(BYTE_TIME);
+
+	HOST_CHECK(Uart_Init(&uart, LPC_USART2, GPDMA_CONN_UART2_Tx) == OS_OK);
+	HOST_CHECK(LPC_USART2->FCR & UART_FCR_DMAMODE_SEL);
+
+	testWriteReturns();
+	testStream();
+
+	printf("test_Uart: ok\n");
+
+	return 0;
+}
+
+/* internal functions definition ---------------------------------------------*/
+
+static void testWriteReturns(void) {
+	const char * message = "a message shorter than a slot\r\n";
+	uint64_t start = Host_TimeUs();
+	uint64_t elapsed;
+	size_t len;
+
+	/* The write only queues the message, the DMA sends it afterwards */
+	HOST_CHECK(Uart_WriteString(&uart, message) == OS_OK);
+	elapsed = Host_TimeUs() - start;
+	len = Host_UartOutput(NULL);
+
+	HOST_CHECK(elapsed < strlen(message) * BYTE_TIME);
+	HOST_CHECK(len < strlen(message));
+
+	HOST_CHECK(Uart_Flush(&uart) == OS_OK);
+	HOST_CHECK(Host_UartOutput(output) == strlen(message));
+	HOST_CHECK(memcmp(output, message, strlen(message)) == 0);
+	HOST_CHECK(uart.count == 0 && uart.busy == false);
+
+	printf("write of %zu bytes returned in %llu us, %zu bytes sent by then\n",
+			strlen(message), (unsigned long long)elapsed, len);
+}
+
+static void testStream(void) {
+	size_t before = Host_UartOutput(NULL);
+	size_t offset = 0;
+	uint32_t seed = 1;
+
+	for(size_t i = 0; i < STREAM_BYTES; i++) {
+		stream[i] = (uint8_t)(i * 7 + i / 251);
+	}
+
+	/* Writes of any length, longer ones span several slots and block the
+	 * writer until the DMA frees one */
+	while(offset < STREAM_BYTES) {
+		size_t len;
+
+		seed = seed * 1103515245 + 12345;
+		len = 1 + (seed >> 16) % (2 * UART_TX_SLOT_SIZE + 10);
+
+		if(len > STREAM_BYTES - offset) {
+			len = STREAM_BYTES - offset;
+		}
+
+		HOST_CHECK(Uart_Write(&uart, stream + offset, len) == OS_OK);
+		offset += len;
+	}
+
+	HOST_CHECK(Uart_Flush(&uart) == OS_OK);
+
+	/* The bytes left the UART in order, none lost or repeated */
+	HOST_CHECK(Host_UartOutput(output) == before + STREAM_BYTES);
+	HOST_CHECK(memcmp(output + before, stream, STREAM_BYTES) == 0);
+	HOST_CHECK(uart.errors == 0);
+
+	printf("stream of %d bytes sent in order\n", STREAM_BYTES);
+}
+
+/* end of file ---------------------------------------------------------------*/
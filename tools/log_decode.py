@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+#
+# log_decode.py
+#
+# Created on: Oct 19, 2026
+# Author: Mauricio Barroso Benavides
+#
+# Formats the binary log records sent by Log_Task() (see inc/os_Log.h). The
+# format strings are read from the ELF file of the firmware, each record only
+# carries the address of its format string and the raw arguments.
+#
+# Usage: log_decode.py firmware.elf [capture.bin | /dev/ttyUSB1] [--clock HZ]
+
+import argparse
+import re
+import struct
+import sys
+
+LOG_FRAME_SYNC = 0xA5
+LOG_ARGS_MAX = 4
+
+SHT_NOBITS = 8
+SHF_ALLOC = 0x2
+
+CONVERSION = re.compile(r'%[-+ #0]*\d*(?:\.\d+)?(?:hh|h|ll|l|z|t|j)?([diouxXcsp%])')
+
+
+class Elf:
+	"""Minimal ELF32 little endian reader, enough to read constant data."""
+
+	def __init__(self, path):
+		with open(path, 'rb') as f:
+			self.data = f.read()
+
+		if self.data[:4] != b'\x7fELF' or self.data[4] != 1:
+			raise ValueError('%s is not an ELF32 file' % path)
+
+		shoff, = struct.unpack_from('<I', self.data, 0x20)
+		shentsize, shnum = struct.unpack_from('<HH', self.data, 0x2E)
+
+		self.sections = []
+
+		for i in range(shnum):
+			_, shtype, flags, addr, offset, size = struct.unpack_from('<IIIIII', self.data, shoff + i * shentsize)
+
+			if flags & SHF_ALLOC and shtype != SHT_NOBITS and size > 0:
+				self.sections.append((addr, offset, size))
+
+	def string(self, addr):
+		for start, offset, size in self.sections:
+			if start <= addr < start + size:
+				begin = offset + addr - start
+				end = self.data.index(b'\x00', begin)
+				return self.data[begin:end].decode('utf-8', 'replace')
+
+		return '<0x%08x>' % addr
+
+
+def format_record(elf, fmt, args):
+	"""Applies the raw arguments to a printf-like format string."""
+	out = []
+	pos = 0
+	index = 0
+
+	for match in CONVERSION.finditer(fmt):
+		out.append(fmt[pos:match.start()])
+		pos = match.end()
+		conv = match.group(1)
+
+		if conv == '%':
+			out.append('%')
+			continue
+
+		value = args[index] if index < len(args) else 0
+		index += 1
+		spec = re.sub(r'(hh|h|ll|l|z|t|j)', '', match.group(0))
+
+		if conv == 's':
+			out.append(spec % elf.string(value))
+		elif conv == 'p':
+			out.append('0x%08x' % value)
+		elif conv in 'di':
+			out.append(spec % struct.unpack('<i', struct.pack('<I', value))[0])
+		elif conv == 'c':
+			out.append(spec % chr(value & 0xFF))
+		else:
+			out.append(spec.replace('u', 'd') % value)
+
+	out.append(fmt[pos:])
+
+	return ''.join(out)
+
+
+def read_frames(stream):
+	"""Yields (format address, timestamp, arguments) for each frame."""
+	while True:
+		sync = stream.read(1)
+
+		if not sync:
+			return
+
+		if sync[0] != LOG_FRAME_SYNC:
+			continue
+
+		header = stream.read(9)
+
+		if len(header) < 9:
+			return
+
+		nargs = header[0]
+
+		if nargs > LOG_ARGS_MAX:
+			continue
+
+		fmt, timestamp = struct.unpack('<II', header[1:])
+		payload = stream.read(4 * nargs)
+
+		if len(payload) < 4 * nargs:
+			return
+
+		yield fmt, timestamp, struct.unpack('<%dI' % nargs, payload)
+
+
+def main():
+	parser = argparse.ArgumentParser(description='Format binary log records')
+	parser.add_argument('elf', help='firmware ELF file')
+	parser.add_argument('input', nargs='?', help='binary capture or serial device, stdin by default')
+	parser.add_argument('--clock', type=float, default=204e6, help='CPU clock in Hz to convert the timestamps')
+	args = parser.parse_args()
+
+	elf = Elf(args.elf)
+	stream = open(args.input, 'rb', buffering=0) if args.input else sys.stdin.buffer
+
+	# The timestamps are the lower 32 bits of the cycles counter, unwrap them
+	last = None
+	high = 0
+
+	for fmt, timestamp, values in read_frames(stream):
+		if last is not None and timestamp < last:
+			high += 1 << 32
+
+		last = timestamp
+		seconds = (high + timestamp) / args.clock
+
+		print('[%12.6f] %s' % (seconds, format_record(elf, elf.string(fmt), values).rstrip('\r\n')), flush=True)
+
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+#
+# size_report.py
+#
+# Created on: Oct 19, 2026
+# Author: Mauricio Barroso Benavides
+#
+# Reports the flash and RAM used by firmware builds of different kernel
+# configurations (see config/os_Config.h). The first ELF file is the
+# reference, the symbols that changed in the others are listed by size.
+#
+# Usage: size_report.py default.elf [minimal.elf ...] [--top N] [--match PREFIX]
+
+import argparse
+import os
+import struct
+import sys
+
+SHT_SYMTAB = 2
+SHT_NOBITS = 8
+SHF_WRITE = 0x1
+SHF_ALLOC = 0x2
+SHF_EXECINSTR = 0x4
+
+STT_OBJECT = 1
+STT_FUNC = 2
+
+
+class Elf:
+	"""Minimal ELF32 little endian reader, enough to read sections and symbols."""
+
+	def __init__(self, path):
+		with open(path, 'rb') as f:
+			self.data = f.read()
+
+		if self.data[:4] != b'\x7fELF' or self.data[4] != 1:
+			raise ValueError('%s is not an ELF32 file' % path)
+
+		shoff, = struct.unpack_from('<I', self.data, 0x20)
+		shentsize, shnum = struct.unpack_from('<HH', self.data, 0x2E)
+
+		self.sections = []
+
+		for i in range(shnum):
+			self.sections.append(struct.unpack_from('<IIIIIIIIII', self.data, shoff + i * shentsize))
+
+	def usage(self):
+		"""Bytes of each kind of section."""
+		usage = {'text': 0, 'rodata': 0, 'data': 0, 'bss': 0}
+
+		for _, shtype, flags, _, _, size, _, _, _, _ in self.sections:
+			if not flags & SHF_ALLOC:
+				continue
+
+			if shtype == SHT_NOBITS:
+				usage['bss'] += size
+			elif flags & SHF_EXECINSTR:
+				usage['text'] += size
+			elif flags & SHF_WRITE:
+				usage['data'] += size
+			else:
+				usage['rodata'] += size
+
+		return usage
+
+	def symbols(self):
+		"""Size of each function and object placed in memory."""
+		symbols = {}
+
+		for _, shtype, _, _, offset, size, link, _, _, entsize in self.sections:
+			if shtype != SHT_SYMTAB:
+				continue
+
+			strtab = self.sections[link][4]
+
+			for i in range(size // entsize):
+				name, _, symsize, info, _, shndx = struct.unpack_from('<IIIBBH', self.data, offset + i * entsize)
+
+				if info & 0xF not in (STT_OBJECT, STT_FUNC) or symsize == 0:
+					continue
+
+				if shndx == 0 or shndx >= len(self.sections) or not self.sections[shndx][2] & SHF_ALLOC:
+					continue
+
+				end = self.data.index(b'\x00', strtab + name)
+				symbols[self.data[strtab + name:end].decode('utf-8', 'replace')] = symsize
+
+		return symbols
+
+
+def main():
+	parser = argparse.ArgumentParser(description='Flash and RAM usage per kernel configuration')
+	parser.add_argument('elf', nargs='+', help='firmware ELF files, the first one is the reference')
+	parser.add_argument('--top', type=int, default=20, help='symbols changed listed per file (default 20)')
+	parser.add_argument('--match', default='', help='only list the symbols that start with this prefix')
+	args = parser.parse_args()
+
+	try:
+		elfs = [Elf(path) for path in args.elf]
+	except (OSError, ValueError) as e:
+		sys.exit(str(e))
+
+	print('%-24s %8s %8s %8s %8s %8s %8s' % ('file', 'text', 'rodata', 'data', 'bss', 'flash', 'ram'))
+
+	for path, elf in zip(args.elf, elfs):
+		u = elf.usage()
+		print('%-24s %8d %8d %8d %8d %8d %8d' % (os.path.basename(path), u['text'], u['rodata'], u['data'], u['bss'],
+				u['text'] + u['rodata'] + u['data'], u['data'] + u['bss']))
+
+	reference = elfs[0].symbols()
+
+	for path, elf in zip(args.elf[1:], elfs[1:]):
+		symbols = elf.symbols()
+		changes = []
+
+		for name in set(reference) | set(symbols):
+			if not name.startswith(args.match):
+				continue
+
+			delta = symbols.get(name, 0) - reference.get(name, 0)
+
+			if delta != 0:
+				changes.append((delta, name))
+
+		changes.sort(key=lambda change: (abs(change[0]), change[1]), reverse=True)
+
+		print('\n%s vs %s: %+d bytes in symbols' % (os.path.basename(path), os.path.basename(args.elf[0]),
+				sum(delta for delta, _ in changes)))
+
+		for delta, name in changes[:args.top]:
+			print('  %+8d  %s' % (delta, name))
+
+
+if __name__ == '__main__':
+	main()